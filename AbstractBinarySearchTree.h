@@ -30,8 +30,7 @@ public:
 	void preOrderDisplay();
 	void inOrderDisplay();
 	void postOrderDisplay();
-//	virtual void rangeSearch(DataType& low, DataType& high) = NULL;
-																//outputs all node values in range low to high inclusive
+	void rangeSearch(const DataType& low, const DataType& high);	//outputs all node values in range low to high inclusive
 };
 
 
@@ -148,5 +147,25 @@ void AbstractBinarySearchTree<DataType>::postOrderDisplay()
 }
 
 
+/*	RANGE METHODS
+*	rangeSearch visits only the subtrees that can hold values between low and high, so it
+*	costs O(height + number of values output) rather than a walk of the whole tree.  Like the
+*	display methods it is not virtual, so a tree of a type without operator<< still compiles
+*	as long as it is not called.
+*/
+template <class DataType>
+void AbstractBinarySearchTree<DataType>::rangeSearch(const DataType& low, const DataType& high)
+{
+	if (isEmpty())
+		return;
+	if (rootData() > low)
+		left()->rangeSearch(low, high);
+	if (!(rootData() < low) && !(rootData() > high))
+		cout << rootData() << " ";
+	if (rootData() < high)
+		right()->rangeSearch(low, high);
+}
+
+
 #endif	//_ABSTRACTBINARYSEARCHTREE_H
 
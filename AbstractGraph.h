@@ -5,6 +5,8 @@
 *	Date:  August 6, 2017
 */
 
+#ifndef _ABSTRACTGRAPH_H
+#define _ABSTRACTGRAPH_H
 
 #include <iostream>
 #include <vector>
@@ -18,10 +20,21 @@ class GraphDuplicateEdge : public GraphException { };
 class GraphEdgeOutOfBounds : public GraphException { };
 class GraphMemory : public GraphException { };
 class GraphNegativeCount : public GraphException { };
+class GraphNegativeEdgeWeight : public GraphException { };
 class GraphNonExistentEdge : public GraphException { };
+class GraphNonIntegerWeight : public GraphException { };
 class GraphVertexOutOfBounds : public GraphException { };
 
 
+//GraphEdge -- one entry of an edge list used to build or update graphs in bulk
+struct GraphEdge
+{
+	int start;
+	int end;
+	double weight;
+};
+
+
 //AbstractGraph abstract class -- top parent graph class, serves as base for all other classes.
 //Defines graph as set of vertices and edges
 template <class VertexObject, class EdgeObject>
@@ -36,10 +49,12 @@ public:
 	virtual double edgeWeight(int start, int end) = NULL;	//returns the weight of the edge, returns 1 in
 															//an unweighted graph
 	virtual EdgeObject& edgeInfo(int start, int end) = NULL;	//returns data associated with the edge
+	virtual const EdgeObject& readEdgeInfo(int start, int end);	//returns edge data without storing any
 	virtual vector<int> neighbors(int v) = NULL;			//returns the neighbors of vertex v
 	virtual void setVertexInfo(int v, VertexObject& info) = NULL;	//sets vertex info
 	virtual void setEdgeInfo(int start, int end, EdgeObject& info) = NULL;	//sets edge info
 	virtual void deleteEdge(int start, int end) = NULL;		//deletes edge between two vertices
+	virtual bool directed();								//returns true if edges have a direction
 	virtual void display(ostream& os);						//displays vertices and edges of the graph
 	virtual void displayNeighbors(int v, ostream& os) = NULL;		//displays the elements of the neighbors vector
 	void printVector(vector<int>, ostream& os);				//prints a vector
@@ -54,6 +69,21 @@ public:
 template <class VertexObject, class EdgeObject>
 AbstractGraph<VertexObject, EdgeObject>::~AbstractGraph() { }
 
+//directed() -- graphs are undirected unless a derived class says otherwise
+template <class VertexObject, class EdgeObject>
+bool AbstractGraph<VertexObject, EdgeObject>::directed()
+{
+	return false;
+}
+
+//readEdgeInfo() -- returns the data of an edge for reading only.  A graph whose edgeInfo()
+//may store an entry for an edge without data overrides this to store nothing.
+template <class VertexObject, class EdgeObject>
+const EdgeObject& AbstractGraph<VertexObject, EdgeObject>::readEdgeInfo(int start, int end)
+{
+	return edgeInfo(start, end);
+}
+
 //display() -- display method for the set of graph classes.  Displays vertices
 //in a vector format and edges in (x,y) format.
 template <class VertexObject, class EdgeObject>
@@ -77,7 +107,7 @@ void AbstractGraph<VertexObject, EdgeObject>::display(ostream& os)
 			{
 				if (first) first = false;
 				else os << ", ";
-				os << "(" << i << "," << j << ") " << edgeInfo(i, j);
+				os << "(" << i << "," << j << ") " << readEdgeInfo(i, j);
 			}
 		}
 	}
@@ -136,3 +166,6 @@ void AbstractGraph<VertexObject, EdgeObject>::printVector(vector<int> v, ostream
 	}
 	os << "]" << endl;
 }
+
+
+#endif	//_ABSTRACTGRAPH_H
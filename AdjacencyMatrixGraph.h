@@ -1,193 +1,397 @@
 /*	AdjacencyMatrixGraph.h
 *	AdjacencyMatrixGraph class implements the adjacency matrix graph model to represent
-*	a set of edges and vertices.  The graph is assumed to be non-directional and unweighted.  
-*	It can be extended to include weighted edges by overloading the addEdge, etc., methods 
-*	or by defining an EdgeObject as a double.
+*	a set of edges and vertices.  The graph is non-directional unless constructed as directed.
+*	addEdge(start, end) gives an edge weight 1 and addEdge(start, end, weight) stores the weight
+*	given.  With an integer EdgeObject, addEdge(start, end, 3) is the info overload; pass 3.0
+*	for a weight.
+*
+*	A graph constructed as directed stores each edge only in its start vertex's row.  It can
+*	also keep an index of the in-edges of every vertex, so pull-style algorithms can list the
+*	vertices pointing at a vertex without scanning a matrix column.
+*
+*	The weights are a WeightMatrix:  one contiguous block with cache-line aligned rows, whose
+*	element type is the WeightType template parameter (double by default; float, uint16_t or
+*	uint8_t save memory on dense graphs).  edges[i][j] reads and writes a weight as before.
+*	A weight is stored cast to WeightType.  Since 0 marks a missing edge, a weight of 0 is
+*	refused, as is one WeightType cannot hold:  a fraction or out-of-range value for an integer
+*	type, or a negative one for an unsigned type.
+*
+*	Edge info is kept in a SparseEdgeData hash table that only has entries for edges given
+*	info, so its memory grows with the edges rather than with V^2.  An undirected edge has one
+*	entry, shared by both directions.  edgeInfo() gives an edge without info a default entry so
+*	that writes through its reference are kept; readEdgeInfo() stores nothing.
+*
+*	Vertices can be added and removed after construction.  The matrix, vertex data and in-edge
+*	index are kept at a capacity that doubles when it runs out, so a run of addVertex() calls
+*	costs amortized O(V) each rather than a rebuild.  A removed vertex loses its edges and its
+*	id goes on a free list for addVertex() to hand out again; ids of the other vertices never
+*	change, and vertexCount() stays one past the largest id in use, so a removed id still
+*	appears to algorithms as an isolated vertex until it is reused.
+*
+*	applyBatch() takes a burst of edge additions and deletions at once.  It checks the whole
+*	batch first, buckets it by matrix row with a counting sort and lets the threads of a
+*	ThreadPool each own a set of rows, so no two threads write the same row and no locks are
+*	taken per edge.  Added edges keep the weights given, as with addEdge().  In-edge lists are
+*	not patched one edge at a time but rebuilt once per batch, each by a single merge.  A batch
+*	holds the graph's batch lock exclusively while it writes; a reader that needs a view no
+*	batch is half-way through takes the lock shared, and version() tells it whether a batch has
+*	been applied since it last looked.  The lock is advisory:  only applyBatch() takes it.
+*	addEdge(), deleteEdge(), addVertex() and the other single-edge and vertex methods do not,
+*	so a caller that mixes them with batches or with readers must hold the lock itself.
 *	Author:  Matthew J. Beattie
 *	Date:  August 6, 2017
 */
 
+#ifndef _ADJACENCYMATRIXGRAPH_H
+#define _ADJACENCYMATRIXGRAPH_H
 
 #include "AbstractGraph.h"
+#include "GraphTraversalWorkspace.h"
+#include "SparseEdgeData.h"
+#include "WeightMatrix.h"
 #include <fstream>
 #include <queue>
 #include <stack>
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <atomic>
+#include <limits>
+#include <cmath>
+#include "ThreadPool.h"
 
 using namespace std;
 
-template <class VertexObject, class EdgeObject>
+const int BFS_TOP_DOWN_ALPHA = 14;								//go bottom-up when frontier > unvisited / alpha
+const int BFS_BOTTOM_UP_BETA = 24;								//go top-down when frontier < vertices / beta
+const int BATCH_ROW_CHUNK = 64;									//matrix rows per applyBatch() work chunk
+
+class GraphBadEdgeWeight : public GraphException { };			//weight 0 or out of WeightType's range
+
+template <class VertexObject, class EdgeObject, class WeightType = double>
 class AdjacencyMatrixGraph :
-	virtual public AbstractGraph<VertexObject, EdgeObject>
+	virtual public AbstractWeightedGraph<VertexObject, EdgeObject>
 {
 protected:
 	vector<VertexObject>* vertexData;
 	void _deleteEdge(int start, int end);
+	void _insertEdge(int start, int end, WeightType weight);	//checks and adds one edge of a stored weight
+	static WeightType _encodeWeight(double weight);				//weight as stored, throws if it cannot be
+	void _addInEdge(int start, int end);						//records start in end's in-edge list
+	void _removeInEdge(int start, int end);						//removes start from end's in-edge list
+	void _orient(int& start, int& end);							//puts an undirected edge in its info key order
+	void _reserve(int n);										//grows the storage to hold ids 0 .. n-1
+	void _clearVertex(int v);									//deletes every edge at v
+	bool _isRemoved(int v);										//true if v is on the free list
+	void _mergeInEdges(vector<vector<pair<int, int>>>& changes, ThreadPool& pool);	//applies a batch to _inEdges
 	int _vertexCount;
-	int _edgeCount;
+	int _edgeCount;												//edges added less edges deleted
+	bool _directed;												//true if edges are stored in one row only
+	bool _indexInEdges;											//true if _inEdges is maintained
+	vector<vector<int>> _inEdges;								//sorted in-neighbors of each vertex
+	SparseEdgeData<EdgeObject> _edgeData;						//info of the edges that have it
+	vector<bool> _removed;										//true for each id on the free list
+	vector<int> _freeIds;										//removed ids, reused last-in first-out
+	shared_timed_mutex _batchLock;								//advisory:  held only by applyBatch(), while it writes
+	atomic<long long> _version;									//number of batches applied
 
 public:
 	//See AbstractGraph.h for descriptions of methods
 	AdjacencyMatrixGraph();
 	AdjacencyMatrixGraph(const int n);
-	AdjacencyMatrixGraph(AdjacencyMatrixGraph<VertexObject, EdgeObject>& g);
-	void copy(AdjacencyMatrixGraph<VertexObject, EdgeObject>& g);
+	AdjacencyMatrixGraph(const int n, bool directed, bool indexInEdges = false);
+	AdjacencyMatrixGraph(AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>& g);
+	void copy(AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>& g);
 	virtual ~AdjacencyMatrixGraph();
-	vector<vector<double>> edges;
-	vector<vector<EdgeObject>> edgeData;
+	WeightMatrix<WeightType> edges;								//weight of each edge, 0 where there is none
 	int edgeCount();
 	int vertexCount();
 	void setVertexCount(int v);
+	int addVertex();											//returns the id of a new vertex without edges
+	int addVertex(VertexObject& info);							//adds a vertex holding info
+	void removeVertex(int v);									//deletes v and its edges, freeing its id
+	bool isVertex(int v);										//true if v is an id in use
+	int liveVertexCount();										//vertices in use, removed ids excluded
+	int capacity();												//ids the storage can hold before growing
 	void setVertexInfo(int v, VertexObject& info);
 	void setEdgeInfo(int start, int end, EdgeObject& info);
 	VertexObject& vertexInfo(int v);
 	bool hasEdge(int start, int end);
 	EdgeObject& edgeInfo(int start, int end);
+	const EdgeObject& readEdgeInfo(int start, int end);
 	double edgeWeight(int start, int end);
 	vector<int> neighbors(int v);
+	int nextNeighbor(int v, int after);							//first neighbor of v above after, -1 if none
+	template <class Visitor>
+	void forEachNeighbor(int v, Visitor& visit);				//calls visit(w) for each neighbor w, without allocating
 	void displayNeighbors(int v, ostream& os);
 	void deleteEdge(int start, int end);
-	void addEdge(int start, int end, EdgeObject info);
+	void addEdge(int start, int end, const EdgeObject& info);
 	void addEdge(int start, int end);
-	void operator= (AdjacencyMatrixGraph<VertexObject, EdgeObject>& g);	//Overloaded = operator to assign graph to another
+	void addEdge(int start, int end, double weight);
+	void addEdge(int start, int end, double weight, EdgeObject& info);
+	int loadEdges(const vector<GraphEdge>& edgeList);			//adds a list of edges, skipping duplicates
+	int applyBatch(const vector<GraphEdge>& additions, const vector<GraphEdge>& deletions, ThreadPool& pool);	//returns edges changed
+	shared_timed_mutex& batchLock();							//lock readers hold shared for a consistent view
+	long long version();										//number of batches applied so far
+	bool directed();											//true if edges have a direction
+	bool indexesInEdges();										//true if the in-edge index is kept
+	vector<int> inNeighbors(int v);								//returns the vertices with an edge to v
+	template <class Visitor>
+	void forEachInNeighbor(int v, Visitor& visit);				//calls visit(w) for each edge (w, v), in order
+	void operator= (AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>& g);	//Overloaded = operator to assign graph to another
 
 	vector<int> breadthFirstSearch(int u, vector<int> &parent);			//returns a vector of the graph vertices in bfs order
 	vector<int> depthFirstSearch(int u, vector<int> &parent);			//returns a vector of the graph vertices in dfs order
+	void breadthFirstSearch(int u, vector<int> &parent, GraphTraversalWorkspace& ws);	//bfs into a reusable workspace
+	void depthFirstSearch(int u, vector<int> &parent, GraphTraversalWorkspace& ws);		//dfs into a reusable workspace
+	vector<int> directionOptimizingBFS(int u, vector<int> &parent);	//bfs that switches to bottom-up steps
+	void directionOptimizingBFS(int u, vector<int> &parent, GraphTraversalWorkspace& ws);
 
 };
 
-//default constructor for BitAdjacencyGraph class
-template <class VertexObject, class EdgeObject>
-AdjacencyMatrixGraph<VertexObject, EdgeObject>::AdjacencyMatrixGraph()
+//default constructor for AdjacencyMatrixGraph class
+template <class VertexObject, class EdgeObject, class WeightType>
+AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::AdjacencyMatrixGraph()
 {
-	this->setVertexCount(0);
 	vertexData = new vector<VertexObject>(0);
+	_vertexCount = 0;
+	_edgeCount = 0;
+	_version = 0;
+	_directed = false;
+	_indexInEdges = false;
 }
 
-//constructor for BitAdjacencyGraph to create graph with n vertices
-template <class VertexObject, class EdgeObject>
-AdjacencyMatrixGraph<VertexObject, EdgeObject>::AdjacencyMatrixGraph(const int n)
+//constructor for AdjacencyMatrixGraph to create graph with n vertices
+template <class VertexObject, class EdgeObject, class WeightType>
+AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::AdjacencyMatrixGraph(const int n)
 {
-	this->setVertexCount(n);
 	vertexData = new vector<VertexObject>(n);
+	_vertexCount = n;
+	_edgeCount = 0;
+	_version = 0;
+	_directed = false;
+	_indexInEdges = false;
+	_removed.resize(n, false);
 
 	edges.resize(n);
-	edgeData.resize(n);
-	for (int i = 0; i < n; i++)
+}
+
+//constructor for a graph with n vertices that may be directed.  With indexInEdges a directed
+//graph also keeps the in-neighbors of every vertex; an undirected graph never needs them.
+template <class VertexObject, class EdgeObject, class WeightType>
+AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::AdjacencyMatrixGraph(const int n, bool directed, bool indexInEdges)
+{
+	vertexData = new vector<VertexObject>(n);
+	_vertexCount = n;
+	_edgeCount = 0;
+	_version = 0;
+	_directed = directed;
+	_indexInEdges = directed && indexInEdges;
+	if (_indexInEdges) _inEdges.resize(n);
+	_removed.resize(n, false);
+
+	edges.resize(n);
+}
+
+
+
+//copy():  makes this graph a deep copy of g.  The old vertex data is freed before it is
+//replaced, and the matrix, edge info, in-edge index and free list are copied with it.
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::copy(AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>& g)
+{
+	if (&g == this) return;
+	delete vertexData;
+	vertexData = new vector<VertexObject>(*g.vertexData);
+	_vertexCount = g._vertexCount;
+	_edgeCount = g._edgeCount;
+	_directed = g._directed;
+	_indexInEdges = g._indexInEdges;
+	_inEdges = g._inEdges;
+	_edgeData = g._edgeData;
+	_removed = g._removed;
+	_freeIds = g._freeIds;
+	edges = g.edges;
+}
+
+//creates a new graph as a copy of an existing one
+template <class VertexObject, class EdgeObject, class WeightType>
+AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::AdjacencyMatrixGraph(AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>& g)
+{
+	vertexData = NULL;
+	_version = 0;
+	this->copy(g);
+}
+
+//overloaded = operator:  copies one graph onto another using the = operator
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::operator= (AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>& g)
+{
+	if (&g != this)
 	{
-		edges[i].resize(n);
-		edgeData[i].resize(n);
+		copy(g);
 	}
 }
 
 
+//destructor for AdjacencyMatrixGraph
+template <class VertexObject, class EdgeObject, class WeightType>
+AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::~AdjacencyMatrixGraph()
+{
+	delete vertexData;
+}
 
-//copy():  Copies an existing vector hash table onto an empty one
-//works by getting number of vertices and copying info and edges one by one
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::copy(AdjacencyMatrixGraph<VertexObject, EdgeObject>& g)
+//setVertexCount():  makes ids 0 .. v-1 the vertices of the graph.  Growing adds vertices
+//without edges; shrinking deletes the edges of the dropped vertices first.
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::setVertexCount(int v)
 {
-	//if exists, delete destination graph
-	if (this->vertexCount() != 0)
+	if (v < 0) throw GraphNegativeCount();
+	if (v < _vertexCount)
 	{
-		for (int i = 0; i < this->vertexCount(); i++)
+		for (int i = v; i < _vertexCount; i++)
 		{
-			if (this->vertexInfo(i) != NULL) this->vertexInfo(i) = NULL;
-			for (int j = 0; j < this->vertexCount(); j++)
-			{
-				if (this->hasEdge(i, j)) this->deleteEdge(i, j);
-			}
+			if (!_removed[i]) _clearVertex(i);
+			(*vertexData)[i] = VertexObject();
+			_removed[i] = false;
 		}
+		vector<int> kept;
+		for (unsigned int i = 0; i < _freeIds.size(); i++)
+			if (_freeIds[i] < v) kept.push_back(_freeIds[i]);
+		_freeIds.swap(kept);
 	}
+	else _reserve(v);
+	_vertexCount = v;
+}
 
-	//sets vertexCount , vertexData, and edges structures equal to the size of the source graph and begins copying
-	int n = g.vertexCount();
-	this->setVertexCount(n);
-	vertexData = new vector<VertexObject>(n);
+//_reserve():  makes room for ids up to n-1, at least doubling the capacity each time it grows
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_reserve(int n)
+{
+	if (n <= edges.size()) return;
+	int grown = max(n, 2 * edges.size());
+	edges.resize(grown);
+	vertexData->resize(grown);
+	_removed.resize(grown, false);
+	if (_indexInEdges) _inEdges.resize(grown);
+}
 
-	edges.resize(n);
-	edgeData.resize(n);
-	for (int i = 0; i < n; i++)
-	{
-		edges[i].resize(n);
-		edgeData[i].resize(n);
-	}
-	if (this->vertexCount() != g.vertexCount()) throw GraphVertexOutOfBounds();
+//returns the number of ids the storage holds before it has to grow
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::capacity()
+{
+	return edges.size();
+}
 
-	for (int i = 0; i < n; i++)
-	{
-		this->setVertexInfo(i, g.vertexInfo(i));
-	}
+//returns true if v is on the free list
+template <class VertexObject, class EdgeObject, class WeightType>
+bool AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_isRemoved(int v)
+{
+	return _removed[v];
 }
 
-//creates a new graph as a copy of an existing one
-template <class VertexObject, class EdgeObject>
-AdjacencyMatrixGraph<VertexObject, EdgeObject>::AdjacencyMatrixGraph(AdjacencyMatrixGraph<VertexObject, EdgeObject>& g)
+//returns true if v is a vertex of the graph:  in range and not removed
+template <class VertexObject, class EdgeObject, class WeightType>
+bool AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::isVertex(int v)
 {
-	if (&g != this)						//Prevents self copy
-	{
-		int tmpVertexCount = g.vertexCount();
-		this->setVertexCount(tmpVertexCount);
-		vertexData = new vector<VertexObject>(tmpVertexCount);
-		edges.resize(tmpVertexCount);
-		edgeData.resize(tmpVertexCount);
-		for (int i = 0; i < tmpVertexCount; i++)
-		{
-			edges[i].resize(tmpVertexCount);
-			edgeData[i].resize(tmpVertexCount);
-		}
+	return (v >= 0) && (v < vertexCount()) && (!_isRemoved(v));
+}
 
-		this->copy(g);
-	}
+//returns the number of vertices in use
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::liveVertexCount()
+{
+	return _vertexCount - (int)_freeIds.size();
 }
 
-//overloaded = operator:  copies one graph onto another using the = operator
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::operator= (AdjacencyMatrixGraph<VertexObject, EdgeObject>& g)
+//addVertex():  returns the most recently freed id if there is one, otherwise the next id,
+//growing the storage if it is full.  The vertex has no edges and default data.
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::addVertex()
 {
-	if (&g != this)
+	if (!_freeIds.empty())
 	{
-		copy(g);
+		int v = _freeIds.back();
+		_freeIds.pop_back();
+		_removed[v] = false;
+		return v;
 	}
+	_reserve(_vertexCount + 1);
+	return _vertexCount++;
 }
 
+//adds a vertex holding info and returns its id
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::addVertex(VertexObject& info)
+{
+	int v = addVertex();
+	(*vertexData)[v] = info;
+	return v;
+}
 
-//destructor for BitAdjacencyGraph
-template <class VertexObject, class EdgeObject>
-AdjacencyMatrixGraph<VertexObject, EdgeObject>::~AdjacencyMatrixGraph() { };
+//removeVertex():  deletes every edge into or out of v, clears its data and puts its id on the
+//free list.  The storage is kept for the id's next use.
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::removeVertex(int v)
+{
+	if (!isVertex(v)) throw GraphVertexOutOfBounds();
+	_clearVertex(v);
+	(*vertexData)[v] = VertexObject();
+	_removed[v] = true;
+	_freeIds.push_back(v);
+}
 
-//set vertex count
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::setVertexCount(int v)
+//_clearVertex():  deletes v's out-edges from its row, then in a directed graph its in-edges,
+//found in the in-edge index or by scanning v's column
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_clearVertex(int v)
 {
-	_vertexCount = v;
+	for (int w = edges.nextNonZero(v, 0); w >= 0; w = edges.nextNonZero(v, w + 1))
+		deleteEdge(v, w);
+	if (!_directed) return;
+	if (_indexInEdges)
+	{
+		vector<int> sources = _inEdges[v];
+		for (unsigned int i = 0; i < sources.size(); i++)
+			deleteEdge(sources[i], v);
+		return;
+	}
+	for (int u = 0; u < _vertexCount; u++)
+		if (edges[u][v] != 0) deleteEdge(u, v);
 }
 
 //return the number of vertices in the graph
-template <class VertexObject, class EdgeObject>
-int AdjacencyMatrixGraph<VertexObject, EdgeObject>::vertexCount()
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::vertexCount()
 {
 	return _vertexCount;
 }
 
-//returns the number of edges in the graph
-template <class VertexObject, class EdgeObject>
-int AdjacencyMatrixGraph<VertexObject, EdgeObject>::edgeCount()
+//returns the number of edges in the graph, kept as edges are added and deleted
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::edgeCount()
 {
-	int count = 0;
-	for (unsigned int i = 0; i < edges.size(); i++)
-	{
-		for (unsigned int j = 0; j < edges[i].size(); i++)
-		{
-			if (edges[i][j] != 0.0)
-				count++;
-		}
-	}
-	return count/2;								//for an undirected graph, divide by 2
+	return _edgeCount;
+}
+
+//returns true if the graph is directed
+template <class VertexObject, class EdgeObject, class WeightType>
+bool AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::directed()
+{
+	return _directed;
+}
+
+//returns true if the in-edges of every vertex are indexed
+template <class VertexObject, class EdgeObject, class WeightType>
+bool AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::indexesInEdges()
+{
+	return _indexInEdges;
 }
 
 //return data associated with a vertex
-template <class VertexObject, class EdgeObject>
-VertexObject& AdjacencyMatrixGraph<VertexObject, EdgeObject>::vertexInfo(int v)
+template <class VertexObject, class EdgeObject, class WeightType>
+VertexObject& AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::vertexInfo(int v)
 {
 	if ((v < 0) || (v >= vertexCount()))
 		throw GraphVertexOutOfBounds();
@@ -195,8 +399,8 @@ VertexObject& AdjacencyMatrixGraph<VertexObject, EdgeObject>::vertexInfo(int v)
 }
 
 //return true if edge exists, false otherwise
-template <class VertexObject, class EdgeObject>
-bool AdjacencyMatrixGraph<VertexObject, EdgeObject>::hasEdge(int start, int end)
+template <class VertexObject, class EdgeObject, class WeightType>
+bool AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::hasEdge(int start, int end)
 {
 	if ((start < 0) || (start >= vertexCount()) || (end < 0)
 		|| (end >= vertexCount()))
@@ -204,39 +408,86 @@ bool AdjacencyMatrixGraph<VertexObject, EdgeObject>::hasEdge(int start, int end)
 	return (edges[start][end] != 0.0);
 }
 
-//return info associated with an edge
-template <class VertexObject, class EdgeObject>
-EdgeObject& AdjacencyMatrixGraph<VertexObject, EdgeObject>::edgeInfo(int start, int end)
+//return info associated with an edge.  An edge that was never given info is stored with a
+//default first, so writes through the reference stay; use readEdgeInfo() to store nothing.
+template <class VertexObject, class EdgeObject, class WeightType>
+EdgeObject& AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::edgeInfo(int start, int end)
 {
 	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount())
 		|| (!hasEdge(start, end)))
 		throw GraphEdgeOutOfBounds();
-	return edgeData[start][end];
+	_orient(start, end);
+	return _edgeData.get(start, end);
+}
+
+//return info associated with an edge without changing the graph; an edge that was never
+//given info returns a default, and concurrent readers are safe while nothing writes
+template <class VertexObject, class EdgeObject, class WeightType>
+const EdgeObject& AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::readEdgeInfo(int start, int end)
+{
+	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount())
+		|| (!hasEdge(start, end)))
+		throw GraphEdgeOutOfBounds();
+	_orient(start, end);
+	return _edgeData.read(start, end);
+}
+
+//an undirected edge keeps its info under (smaller end, larger end)
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_orient(int& start, int& end)
+{
+	if ((!_directed) && (start > end))
+	{
+		int t = start;
+		start = end;
+		end = t;
+	}
 }
 
 //return weight of an edge
-template <class VertexObject, class EdgeObject>
-double AdjacencyMatrixGraph<VertexObject, EdgeObject>::edgeWeight(int start, int end)
+template <class VertexObject, class EdgeObject, class WeightType>
+double AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::edgeWeight(int start, int end)
 {
 	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount()))
 		throw GraphEdgeOutOfBounds();
-	return edges[start][end];
+	return (double)edges[start][end];
 }
 
 //return vector of neighbors of vertex
-template <class VertexObject, class EdgeObject>
-vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject>::neighbors(int v)
+template <class VertexObject, class EdgeObject, class WeightType>
+vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::neighbors(int v)
 {
 	vector<int> result;
 	if ((v < 0) || (v >= vertexCount())) return result;
-	for (int i = 0; i < vertexCount(); i++)
-		if (edges[v][i] != 0.0) result.push_back(i);
+	result.reserve(edges.countNonZero(v));
+	for (int i = edges.nextNonZero(v, 0); i >= 0; i = edges.nextNonZero(v, i + 1))
+		result.push_back(i);
 	return result;
 }
 
+//returns the first neighbor of v numbered above after, or -1 when there are no more.  Pass
+//after = -1 to get the first neighbor:
+//	for (int w = g.nextNeighbor(v, -1); w >= 0; w = g.nextNeighbor(v, w)) ...
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::nextNeighbor(int v, int after)
+{
+	if ((v < 0) || (v >= vertexCount())) return -1;
+	return edges.nextNonZero(v, after + 1);
+}
+
+//calls visit(w) for every neighbor w of v in ascending order, without building a vector
+template <class VertexObject, class EdgeObject, class WeightType>
+template <class Visitor>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::forEachNeighbor(int v, Visitor& visit)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+	for (int i = edges.nextNonZero(v, 0); i >= 0; i = edges.nextNonZero(v, i + 1))
+		visit(i);
+}
+
 //displayNeighbors():  displays the neighbors of a vertex into an ostream
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::displayNeighbors(int v, ostream& os)
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::displayNeighbors(int v, ostream& os)
 {
 	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
 	vector<int> neighborList = neighbors(v);
@@ -245,132 +496,590 @@ void AdjacencyMatrixGraph<VertexObject, EdgeObject>::displayNeighbors(int v, ost
 }
 
 //set the information of a vertex in a graph
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::setVertexInfo(int v, VertexObject& info)
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::setVertexInfo(int v, VertexObject& info)
 {
 	if ((v < 0) || (v >= vertexCount())) return;
 	(*vertexData)[v] = info;
 }
 
-//set the information of an edge in a graph
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::setEdgeInfo(int start, int end, EdgeObject& info)
+//set the information of an existing edge in a graph
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::setEdgeInfo(int start, int end, EdgeObject& info)
 {
 	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount()))
 		throw GraphEdgeOutOfBounds();
-	edgeData[start][end] = info;
+	if (!hasEdge(start, end)) throw GraphNonExistentEdge();
+	_orient(start, end);
+	_edgeData.set(start, end, info);
 }
 
 //delete an edge in the graph using the protected method
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::_deleteEdge(int start, int end)
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_deleteEdge(int start, int end)
 {
 	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount())
 		|| (!hasEdge(start, end)))
 		throw GraphEdgeOutOfBounds();
-	edges[start][end] = 0.0;
+	edges[start][end] = 0;
 }
 
-//delete an edge in the graph using the public method
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::deleteEdge(int start, int end)
+//delete an edge in the graph using the public method; an undirected edge is removed from
+//both rows, a directed one only from start's row
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::deleteEdge(int start, int end)
 {
 	_deleteEdge(start, end);
-	_deleteEdge(end, start);
+	if (_directed)
+	{
+		if (_indexInEdges) _removeInEdge(start, end);
+	}
+	else if (start != end)
+		_deleteEdge(end, start);
+	_orient(start, end);
+	_edgeData.erase(start, end);
+	_edgeCount--;
 }
 
-//add an edge in the graph that doesn't contain any info
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::addEdge(int start, int end)
+//_insertEdge():  adds an edge holding a weight already in stored form, after checking both
+//ends are vertices and the edge is new
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_insertEdge(int start, int end, WeightType weight)
 {
-	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount()))
+	if ((!isVertex(start)) || (!isVertex(end)))
 		throw GraphEdgeOutOfBounds();
 	if (hasEdge(start, end)) throw GraphDuplicateEdge();
-	edges[start][end] = 1;
-	edges[end][start] = 1;
+	edges[start][end] = weight;
+	if (!_directed)
+		edges[end][start] = weight;
+	else if (_indexInEdges)
+		_addInEdge(start, end);
+	_edgeCount++;
 }
 
-//add an edge in the graph that contains info
-template <class VertexObject, class EdgeObject>
-void AdjacencyMatrixGraph<VertexObject, EdgeObject>::addEdge(int start, int end, EdgeObject info)
+//_encodeWeight():  the weight cast to WeightType.  A fraction for an integer type, a negative
+//weight for an unsigned type, a weight out of range or one that is 0 once cast all throw.
+template <class VertexObject, class EdgeObject, class WeightType>
+WeightType AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_encodeWeight(double weight)
 {
-	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount()))
-		throw GraphEdgeOutOfBounds();
-	if (hasEdge(start, end)) throw GraphDuplicateEdge();
-	edges[start][end] = 1;
-	edgeData[start][end] = info;
+	if (numeric_limits<WeightType>::is_integer && (weight != floor(weight))) throw GraphNonIntegerWeight();
+	if ((weight < 0) && (numeric_limits<WeightType>::lowest() == 0)) throw GraphNegativeEdgeWeight();
+	if (!((weight >= (double)numeric_limits<WeightType>::lowest()) && (weight <= (double)numeric_limits<WeightType>::max())))
+		throw GraphBadEdgeWeight();
+	WeightType stored = (WeightType)weight;
+	if (stored == 0) throw GraphBadEdgeWeight();
+	return stored;
+}
+
+//add an edge of weight 1 that doesn't contain any info
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::addEdge(int start, int end)
+{
+	_insertEdge(start, end, 1);
+}
+
+//add an edge of weight 1 that contains info
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::addEdge(int start, int end, const EdgeObject& info)
+{
+	_insertEdge(start, end, 1);
+	_orient(start, end);
+	_edgeData.set(start, end, info);
+}
+
+//add a weighted edge that doesn't contain any info
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::addEdge(int start, int end, double weight)
+{
+	_insertEdge(start, end, _encodeWeight(weight));
+}
+
+//add a weighted edge that contains info
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::addEdge(int start, int end, double weight, EdgeObject& info)
+{
+	_insertEdge(start, end, _encodeWeight(weight));
+	_orient(start, end);
+	_edgeData.set(start, end, info);
+}
+
+//records start as an in-neighbor of end, keeping the list sorted
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_addInEdge(int start, int end)
+{
+	vector<int>& list = _inEdges[end];
+	list.insert(lower_bound(list.begin(), list.end(), start), start);
+}
+
+//removes start from the in-neighbors of end
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_removeInEdge(int start, int end)
+{
+	vector<int>& list = _inEdges[end];
+	vector<int>::iterator p = lower_bound(list.begin(), list.end(), start);
+	if ((p != list.end()) && (*p == start)) list.erase(p);
+}
 
-	edges[end][start] = 1;
-	edgeData[end][start] = info;
+//returns the vertices with an edge to v in ascending order.  For an undirected graph these
+//are the neighbors of v; a directed graph without the in-edge index scans v's column.
+template <class VertexObject, class EdgeObject, class WeightType>
+vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::inNeighbors(int v)
+{
+	vector<int> result;
+	if ((v < 0) || (v >= vertexCount())) return result;
+	if (!_directed) return neighbors(v);
+	if (_indexInEdges) return _inEdges[v];
+	for (int i = 0; i < vertexCount(); i++)
+		if (edges[i][v] != 0.0) result.push_back(i);
+	return result;
+}
+
+//calls visit(w) for every vertex w with an edge to v, in ascending order
+template <class VertexObject, class EdgeObject, class WeightType>
+template <class Visitor>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::forEachInNeighbor(int v, Visitor& visit)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+	if (!_directed)
+	{
+		forEachNeighbor(v, visit);
+		return;
+	}
+	if (_indexInEdges)
+	{
+		const vector<int>& list = _inEdges[v];
+		for (unsigned int i = 0; i < list.size(); i++)
+			visit(list[i]);
+		return;
+	}
+	int n = vertexCount();
+	for (int i = 0; i < n; i++)
+		if (edges[i][v] != 0.0) visit(i);
+}
+
+//loadEdges():  adds every edge of a list in one pass and returns the number added.  All ends
+//and weights are checked before anything is changed; an edge that already exists or appears
+//twice in the list is skipped rather than throwing GraphDuplicateEdge, so the first weight
+//given for it stays.
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::loadEdges(const vector<GraphEdge>& edgeList)
+{
+	int n = vertexCount();
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		const GraphEdge& e = edgeList[i];
+		if ((e.start < 0) || (e.start >= n) || (e.end < 0) || (e.end >= n)
+			|| (_isRemoved(e.start)) || (_isRemoved(e.end)))
+			throw GraphEdgeOutOfBounds();
+		_encodeWeight(e.weight);
+	}
+	int added = 0;
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		const GraphEdge& e = edgeList[i];
+		if (edges[e.start][e.end] != 0.0) continue;
+		WeightType weight = _encodeWeight(e.weight);
+		edges[e.start][e.end] = weight;
+		if (!_directed)
+			edges[e.end][e.start] = weight;
+		else if (_indexInEdges)
+			_addInEdge(e.start, e.end);
+		added++;
+	}
+	_edgeCount += added;
+	return added;
+}
+
+//applyBatch():  deletes every edge of deletions, then adds every edge of additions, and
+//returns the number of edges deleted plus the number added.  All ends and weights are checked
+//before anything changes.  Each added edge stores its weight as addEdge() would.  Repeated
+//entries count once and the last weight given wins, deleting an edge that is not there does
+//nothing, adding one that is only sets its weight and keeps its info, and an edge in both
+//lists ends up present without info.
+//
+//The entries are bucketed by row, an undirected edge into both of its rows, before the batch
+//lock is taken; the bucketing is stable and places all deletions first, so each bucket is
+//already in the order it must be applied.  Each entry's stored weight sits beside it in a
+//parallel array, 0 for a deletion.  Then each thread applies the buckets of its own rows.  A
+//repeated entry finds its cell already set and changes no count, so the matrix removes
+//duplicates itself and the buckets need no sort.  Only the entry in the row of an
+//edge's start (the smaller end if undirected) is counted, and only it records the change for
+//the in-edge lists and edge info.
+template <class VertexObject, class EdgeObject, class WeightType>
+int AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::applyBatch(const vector<GraphEdge>& additions,
+	const vector<GraphEdge>& deletions, ThreadPool& pool)
+{
+	int n = vertexCount();
+	const vector<GraphEdge>* lists[2] = { &deletions, &additions };
+	for (int k = 0; k < 2; k++)
+	{
+		for (unsigned int i = 0; i < lists[k]->size(); i++)
+		{
+			const GraphEdge& e = (*lists[k])[i];
+			if ((e.start < 0) || (e.start >= n) || (e.end < 0) || (e.end >= n)
+				|| (_isRemoved(e.start)) || (_isRemoved(e.end)))
+				throw GraphEdgeOutOfBounds();
+			if (k == 1) _encodeWeight(e.weight);
+		}
+	}
+
+	//an operation is (column << 2) | (1 if an addition) << 1 | (1 if in the start's row)
+	vector<int> offsets(n + 1, 0);
+	for (int k = 0; k < 2; k++)
+	{
+		for (unsigned int i = 0; i < lists[k]->size(); i++)
+		{
+			int start = (*lists[k])[i].start;
+			int end = (*lists[k])[i].end;
+			_orient(start, end);
+			offsets[start + 1]++;
+			if ((!_directed) && (start != end)) offsets[end + 1]++;
+		}
+	}
+	for (int v = 0; v < n; v++)
+		offsets[v + 1] += offsets[v];
+	vector<long long> ops(offsets[n]);
+	vector<WeightType> weights(offsets[n]);						//stored weight of each operation
+	vector<int> position(offsets.begin(), offsets.end() - 1);
+	for (int k = 0; k < 2; k++)
+	{
+		for (unsigned int i = 0; i < lists[k]->size(); i++)
+		{
+			int start = (*lists[k])[i].start;
+			int end = (*lists[k])[i].end;
+			WeightType weight = (k == 1) ? _encodeWeight((*lists[k])[i].weight) : 0;
+			_orient(start, end);
+			weights[position[start]] = weight;
+			ops[position[start]++] = ((long long)end << 2) | (k << 1) | 1;
+			if ((!_directed) && (start != end))
+			{
+				weights[position[end]] = weight;
+				ops[position[end]++] = ((long long)start << 2) | (k << 1);
+			}
+		}
+	}
+
+	unique_lock<shared_timed_mutex> guard(_batchLock);
+	int threads = pool.threadCount();
+	bool keepInfo = !_edgeData.isEmpty();
+	vector<long long> added(threads, 0);
+	vector<long long> deleted(threads, 0);
+	vector<vector<pair<int, int>>> erased(threads);				//deleted edges whose info must go
+	vector<vector<pair<int, int>>> inChanges(threads);			//(start, end * 2 + 1 if added)
+	pool.parallelFor(0, n, BATCH_ROW_CHUNK, [&](int low, int high, int thread)
+	{
+		for (int u = low; u < high; u++)
+		{
+			const long long* last = ops.data() + offsets[u + 1];
+			const WeightType* weight = weights.data() + offsets[u];
+			WeightType* row = edges[u];
+			for (const long long* op = ops.data() + offsets[u]; op < last; op++, weight++)
+			{
+				int column = (int)(*op >> 2);
+				bool add = ((*op >> 1) & 1) != 0;
+				bool counted = (*op & 1) != 0;
+				bool present = (row[column] != 0);
+				if ((!add) && (!present)) continue;
+				row[column] = *weight;
+				if ((add && present) || (!counted)) continue;
+				if (add) added[thread]++;
+				else
+				{
+					deleted[thread]++;
+					if (keepInfo) erased[thread].push_back(make_pair(u, column));
+				}
+				if (_indexInEdges) inChanges[thread].push_back(make_pair(u, column * 2 + (add ? 1 : 0)));
+			}
+		}
+	});
+
+	long long changed = 0;
+	for (int t = 0; t < threads; t++)
+	{
+		_edgeCount += (int)(added[t] - deleted[t]);
+		changed += added[t] + deleted[t];
+		for (unsigned int i = 0; i < erased[t].size(); i++)
+			_edgeData.erase(erased[t][i].first, erased[t][i].second);
+	}
+	if (_indexInEdges) _mergeInEdges(inChanges, pool);
+	_version++;
+	return (int)changed;
+}
+
+//_mergeInEdges():  buckets a batch's changed edges by end vertex, then rebuilds each touched
+//in-edge list with one pass that drops the deleted starts and merges in the added ones
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::_mergeInEdges(vector<vector<pair<int, int>>>& changes,
+	ThreadPool& pool)
+{
+	int n = vertexCount();
+	vector<int> offsets(n + 1, 0);
+	for (unsigned int t = 0; t < changes.size(); t++)
+		for (unsigned int i = 0; i < changes[t].size(); i++)
+			offsets[changes[t][i].second / 2 + 1]++;
+	for (int v = 0; v < n; v++)
+		offsets[v + 1] += offsets[v];
+	vector<int> bucket(offsets[n]);								//start * 2 + 1 if added
+	vector<int> position(offsets.begin(), offsets.end() - 1);
+	for (unsigned int t = 0; t < changes.size(); t++)
+	{
+		for (unsigned int i = 0; i < changes[t].size(); i++)
+		{
+			const pair<int, int>& c = changes[t][i];
+			bucket[position[c.second / 2]++] = c.first * 2 + (c.second & 1);
+		}
+		vector<pair<int, int>>().swap(changes[t]);
+	}
+
+	pool.parallelFor(0, n, BATCH_ROW_CHUNK, [&](int low, int high, int /*thread*/)
+	{
+		vector<int> removed, inserted, kept;
+		for (int v = low; v < high; v++)
+		{
+			if (offsets[v] == offsets[v + 1]) continue;
+			removed.clear();
+			inserted.clear();
+			for (int i = offsets[v]; i < offsets[v + 1]; i++)
+			{
+				if (bucket[i] & 1) inserted.push_back(bucket[i] / 2);
+				else removed.push_back(bucket[i] / 2);
+			}
+			sort(removed.begin(), removed.end());
+			sort(inserted.begin(), inserted.end());
+			vector<int>& list = _inEdges[v];
+			kept.clear();
+			set_difference(list.begin(), list.end(), removed.begin(), removed.end(), back_inserter(kept));
+			list.resize(kept.size() + inserted.size());
+			merge(kept.begin(), kept.end(), inserted.begin(), inserted.end(), list.begin());
+		}
+	});
+}
+
+//returns the lock applyBatch() holds exclusively while it writes.  Hold it shared, e.g. with
+//shared_lock<shared_timed_mutex>, to read the graph with no batch part-way applied.  No other
+//method takes it, so hold it exclusively around addEdge(), deleteEdge() or vertex changes
+//made while others may be reading.
+template <class VertexObject, class EdgeObject, class WeightType>
+shared_timed_mutex& AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::batchLock()
+{
+	return _batchLock;
+}
+
+//returns the number of batches applied, so a reader can tell whether its view is current.  The
+//count is atomic, so it may be read without the lock while a batch is being applied.
+template <class VertexObject, class EdgeObject, class WeightType>
+long long AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::version()
+{
+	return _version;
 }
 
 //breadthFirstSearch():  implements a bfs across the graph and stores the order of vertices
 //visited into a vector and returns to the calling function
-template <class VectorObject, class EdgeObject>
-vector<int> AdjacencyMatrixGraph<VectorObject, EdgeObject>::breadthFirstSearch(int u, vector<int> &parent)
-{
-	int v;											//node popped from the queue
-	int w;											//neighbor node of v
-	vector<int> nbors;								//neighbors vector of v
-	int BFSnum = 1;
-
-	//breadth-first-serach counter starts at 1 (value for u)
-	std::queue<int> Q;
-	vector<int> BFSnums(this->vertexCount(), 0);	//initialize a vector of visited vertices to 0
-	BFSnums[u] = 1;									//counter starts at 1
-	Q.push(u);
+template <class VertexObject, class EdgeObject, class WeightType>
+vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::breadthFirstSearch(int u, vector<int> &parent)
+{
+	GraphTraversalWorkspace ws;
+	breadthFirstSearch(u, parent, ws);
+	return ws.order;
+}
+
+//breadthFirstSearch():  bfs that keeps all of its state in ws.  On return ws.order holds the
+//bfs number of each vertex (0 if unreached) and ws.touched the vertices in bfs order.  The
+//queue is ws.buffer used as an array with a head index, and neighbors are scanned in place.
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::breadthFirstSearch(int u, vector<int> &parent, GraphTraversalWorkspace& ws)
+{
+	if ((u < 0) || (u >= vertexCount())) throw GraphVertexOutOfBounds();
+	ws.reset(vertexCount());
+	ws.visit(u);										//bfs counter starts at 1 (value for u)
+	ws.buffer.push_back(u);
 	parent[u] = -1;
-	while (!Q.empty())
+	for (unsigned int head = 0; head < ws.buffer.size(); head++)
 	{
-		v = Q.front();
-		Q.pop();
-		nbors = neighbors(v);
-		for (unsigned int i = 0; i < nbors.size(); i++)
+		int v = ws.buffer[head];						//node popped from the queue
+		for (int w = nextNeighbor(v, -1); w >= 0; w = nextNeighbor(v, w))
 		{
-			w = nbors[i];
-			if (BFSnums[w] == 0)
+			if (!ws.isVisited(w))
 			{
-				BFSnum = BFSnum + 1;
-				BFSnums[w] = BFSnum;
-				Q.push(w);
+				ws.visit(w);
+				ws.buffer.push_back(w);
 				parent[w] = v;
 			}
 		}
 	}
-	return BFSnums;
 }
 
 //depthFirstSearch():  implements a dfs across the graph and stores the order of vertices
 //of visited.  Updates a parent node vector to show the parents of each nodes.
-template <class VertexObject, class EdgeObject>
-vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject>::depthFirstSearch(int u, vector<int> &parent)
-{
-	int v;							//node popped from stack
-	int w;							//neighbor of node v
-	int depth = 1;					//depth-first-search number
-	vector<int> nbors;				//array of neighbors for node v
-
-	vector<int> DFSnums(this->vertexCount(), 0);	//initialize a vector of visited vertices to 0
-	std::stack<int> S;
-	DFSnums[u] = depth;
-	S.push(u);
+template <class VertexObject, class EdgeObject, class WeightType>
+vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::depthFirstSearch(int u, vector<int> &parent)
+{
+	GraphTraversalWorkspace ws;
+	depthFirstSearch(u, parent, ws);
+	return ws.order;
+}
+
+//depthFirstSearch():  dfs that keeps all of its state in ws, using ws.buffer as the stack.
+//Vertices are numbered when they are pushed, as in the original version.
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::depthFirstSearch(int u, vector<int> &parent, GraphTraversalWorkspace& ws)
+{
+	if ((u < 0) || (u >= vertexCount())) throw GraphVertexOutOfBounds();
+	ws.reset(vertexCount());
+	ws.visit(u);
+	ws.buffer.push_back(u);
 	parent[u] = -1;
-	while (!S.empty())
+	while (!ws.buffer.empty())
 	{
-		v = S.top();
-		S.pop();
-		nbors = neighbors(v);
-		for (unsigned int i = 0; i < nbors.size(); i++)
+		int v = ws.buffer.back();						//node popped from stack
+		ws.buffer.pop_back();
+		for (int w = nextNeighbor(v, -1); w >= 0; w = nextNeighbor(v, w))
 		{
-			w = nbors[i];
-			if (DFSnums[w] == 0)
+			if (!ws.isVisited(w))
 			{
-				depth = depth + 1;
-				DFSnums[w] = depth;
-				S.push(w);
+				ws.visit(w);
+				ws.buffer.push_back(w);
 				parent[w] = v;
 			}
 		}
 	}
-	return DFSnums;
 }
+
+//directionOptimizingBFS():  returns the same bfs numbers and parents as breadthFirstSearch()
+template <class VertexObject, class EdgeObject, class WeightType>
+vector<int> AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::directionOptimizingBFS(int u, vector<int> &parent)
+{
+	GraphTraversalWorkspace ws;
+	directionOptimizingBFS(u, parent, ws);
+	return ws.order;
+}
+
+//directionOptimizingBFS():  level-by-level bfs that chooses a direction for every level
+//(Beamer, Asanovic and Patterson).  A top-down step scans the rows of the frontier vertices.
+//A bottom-up step instead checks each unvisited vertex for an edge from the frontier, stopping
+//at the first one it finds; once the frontier is large this touches far fewer matrix entries,
+//because most of a top-down scan finds vertices already visited.  The frontier is marked in a
+//bitmap, so the check walks the in-neighbors of the vertex:  its own row in an undirected
+//graph, its in-edge list in a directed graph that indexes them.  A directed graph without the
+//in-edge index could only find its in-neighbors by reading a matrix column, so it stays
+//top-down.
+//
+//The matrix gives no O(1) degrees, so the switch uses the vertex-count form of Beamer's test:
+//go bottom-up when the frontier holds more than 1/alpha of the unvisited vertices, and back
+//top-down when it falls below 1/beta of all vertices.
+//
+//The result is identical to breadthFirstSearch().  A bottom-up step takes the frontier
+//in-neighbor with the smallest bfs number as the parent, which is the vertex a top-down scan
+//would reach it from first.  The new level is then counting-sorted by parent position, with
+//vertices of the same parent in ascending order, which is the order a top-down scan would
+//queue them in.
+template <class VertexObject, class EdgeObject, class WeightType>
+void AdjacencyMatrixGraph<VertexObject, EdgeObject, WeightType>::directionOptimizingBFS(int u, vector<int> &parent, GraphTraversalWorkspace& ws)
+{
+	if ((u < 0) || (u >= vertexCount())) throw GraphVertexOutOfBounds();
+	int n = vertexCount();
+	ws.reset(n);
+	ws.visit(u);
+	ws.buffer.push_back(u);
+	parent[u] = -1;
+
+	bool canGoBottomUp = (!_directed) || _indexInEdges;
+	bool topDown = true;
+	int levelStart = 0;											//the frontier is ws.buffer[levelStart, levelEnd)
+	while (levelStart < (int)ws.buffer.size())
+	{
+		int levelEnd = (int)ws.buffer.size();
+		int frontierSize = levelEnd - levelStart;
+		int unvisited = n - (int)ws.touched.size();
+		if (topDown && canGoBottomUp && ((long long)frontierSize * BFS_TOP_DOWN_ALPHA > unvisited))
+			topDown = false;
+		else if (!topDown && ((long long)frontierSize * BFS_BOTTOM_UP_BETA < n))
+			topDown = true;
+
+		if (topDown)
+		{
+			for (int head = levelStart; head < levelEnd; head++)
+			{
+				int v = ws.buffer[head];
+				for (int w = nextNeighbor(v, -1); w >= 0; w = nextNeighbor(v, w))
+				{
+					if (!ws.isVisited(w))
+					{
+						ws.visit(w);
+						ws.buffer.push_back(w);
+						parent[w] = v;
+					}
+				}
+			}
+		}
+		else
+		{
+			//mark the frontier, then find the earliest frontier in-neighbor of each unvisited vertex.
+			//An in-edge list is short, so all of it is read.  A row is as long as the graph, so it
+			//is read only up to the first frontier vertex, which shows that w joins this level, and
+			//the frontier is then walked up to that vertex for an earlier one with an edge to w.
+			//ws.touched is in queue order, so a vertex's frontier slot follows from its number.
+			ws.frontier.assign((n + 63) / 64, 0);
+			for (int slot = levelStart; slot < levelEnd; slot++)
+			{
+				int f = ws.buffer[slot];
+				ws.frontier[f >> 6] |= (uint64_t)1 << (f & 63);
+			}
+			ws.found.clear();
+			for (int w = 0; w < n; w++)
+			{
+				if (ws.isVisited(w)) continue;
+				int f = -1;
+				if (_directed)
+				{
+					const vector<int>& in = _inEdges[w];
+					for (unsigned int i = 0; i < in.size(); i++)
+					{
+						if (((ws.frontier[in[i] >> 6] >> (in[i] & 63)) & 1) && ((f < 0) || (ws.order[in[i]] < ws.order[f])))
+							f = in[i];
+					}
+				}
+				else
+				{
+					for (int x = nextNeighbor(w, -1); x >= 0; x = nextNeighbor(w, x))
+					{
+						if ((ws.frontier[x >> 6] >> (x & 63)) & 1)
+						{
+							f = x;
+							break;
+						}
+					}
+					for (int slot = levelStart; (f >= 0) && (ws.buffer[slot] != f); slot++)
+					{
+						if (edges[ws.buffer[slot]][w] != 0)
+						{
+							f = ws.buffer[slot];
+							break;
+						}
+					}
+				}
+				if (f < 0) continue;
+				parent[w] = f;
+				ws.found.push_back(ws.order[f] - 1 - levelStart);
+				ws.found.push_back(w);
+			}
+
+			//counting sort by frontier slot; w was found in ascending order within each slot
+			ws.counts.assign(frontierSize + 1, 0);
+			for (unsigned int i = 0; i < ws.found.size(); i += 2)
+				ws.counts[ws.found[i] + 1]++;
+			for (int slot = 0; slot < frontierSize; slot++)
+				ws.counts[slot + 1] += ws.counts[slot];
+			int newCount = (int)ws.found.size() / 2;
+			ws.buffer.resize(levelEnd + newCount);
+			for (unsigned int i = 0; i < ws.found.size(); i += 2)
+				ws.buffer[levelEnd + ws.counts[ws.found[i]]++] = ws.found[i + 1];
+			for (int i = levelEnd; i < levelEnd + newCount; i++)
+				ws.visit(ws.buffer[i]);
+		}
+		levelStart = levelEnd;
+	}
+}
+
+
+#endif	//_ADJACENCYMATRIXGRAPH_H
@@ -0,0 +1,522 @@
+/*	AggregateBinarySearchTree.h
+*	AggregateBinarySearchTree is a binary search tree in which every subtree also stores an
+*	aggregate (sum, min, max, ...) of the values below it.  The aggregate is described by a
+*	monoid class supplied as a template parameter, which must provide:
+*		typedef ... ValueType;							type of the aggregate
+*		static ValueType identity();					aggregate of an empty range
+*		static ValueType lift(const DataType& data);	aggregate of a single element
+*		static ValueType combine(const ValueType& a, const ValueType& b);
+*														aggregate of a range followed by another
+*	combine must be associative but need not be commutative; ranges are always combined in key
+*	order.  insert() and remove() recompute the aggregates on the path they change, and
+*	rangeAggregate()/prefixAggregate() read O(height) stored aggregates instead of visiting
+*	every element in the range.
+*
+*	The tree is a treap, as PersistentBinarySearchTree is:  every node carries a random priority
+*	that is never below its children's, so the height is O(log n) with high probability even
+*	when the data arrives sorted.  A rotation swaps the contents of a node and its child in
+*	place, so the root object never moves, and recomputes the aggregates of both.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _AGGREGATEBINARYSEARCHTREE_H
+#define _AGGREGATEBINARYSEARCHTREE_H
+
+#include <iostream>
+#include <algorithm>
+#include <limits>
+#include <atomic>
+#include "Exception.h"
+#include "AbstractBinarySearchTree.h"
+#include "BinarySearchTree.h"
+
+using namespace std;
+
+
+//SumMonoid -- sum of the elements of a range
+template <class DataType>
+class SumMonoid
+{
+public:
+	typedef DataType ValueType;
+	static ValueType identity() { return ValueType(); }
+	static ValueType lift(const DataType& data) { return data; }
+	static ValueType combine(const ValueType& a, const ValueType& b) { return a + b; }
+};
+
+//MinMonoid -- smallest element of a range
+template <class DataType>
+class MinMonoid
+{
+public:
+	typedef DataType ValueType;
+	static ValueType identity() { return numeric_limits<DataType>::max(); }
+	static ValueType lift(const DataType& data) { return data; }
+	static ValueType combine(const ValueType& a, const ValueType& b) { return std::min(a, b); }
+};
+
+//MaxMonoid -- largest element of a range
+template <class DataType>
+class MaxMonoid
+{
+public:
+	typedef DataType ValueType;
+	static ValueType identity() { return numeric_limits<DataType>::lowest(); }
+	static ValueType lift(const DataType& data) { return data; }
+	static ValueType combine(const ValueType& a, const ValueType& b) { return std::max(a, b); }
+};
+
+
+template <class DataType, class Monoid>
+class AggregateBinarySearchTree : virtual public AbstractBinarySearchTree<DataType>
+{
+public:
+	typedef typename Monoid::ValueType ValueType;
+
+protected:
+	DataType* _rootData;										//pointer to data at root
+	AggregateBinarySearchTree<DataType, Monoid>* _left;			//pointer to left subtree
+	AggregateBinarySearchTree<DataType, Monoid>* _right;		//pointer to right subtree
+	bool _subtree;												//true if tree contains a subtree
+	ValueType _aggregate;										//aggregate of every element in this subtree
+	unsigned int _priority;										//treap priority, at least that of either child
+	static unsigned int _nextPriority();						//returns a random priority for a new node
+	void _makeNull();											//sets all pointers to NULL
+	void _update();												//recomputes _aggregate from the children
+	void _takeOver(AggregateBinarySearchTree<DataType, Monoid>* child);	//replaces this node with child
+	void _rotateLeft();											//lifts the right child into this node
+	void _rotateRight();										//lifts the left child into this node
+	void _insert(const DataType& data);							//recursive insert, updates the path
+	void _remove(const DataType& data);							//recursive remove, updates the path
+	ValueType _aggregateAtLeast(const DataType& low);			//aggregate of elements >= low
+	ValueType _aggregateAtMost(const DataType& high);			//aggregate of elements <= high
+
+public:
+	AggregateBinarySearchTree();								//empty constructor
+	AggregateBinarySearchTree(const DataType& data);			//constructor with data input
+	virtual ~AggregateBinarySearchTree();						//destructor
+	AggregateBinarySearchTree<DataType, Monoid>* makeSubtree();	//creates an empty subtree
+	bool subtree();												//returns value of _subtree
+	void makeEmpty();											//deletes the structure of the tree
+
+	bool isEmpty();												//true if tree is empty, false otherwise
+	int Height();												//returns height of tree
+	int Size();													//returns number of nodes in tree
+	DataType& rootData();										//returns data from root
+	AggregateBinarySearchTree<DataType, Monoid>* left();		//returns pointer to left subtree
+	AggregateBinarySearchTree<DataType, Monoid>* right();		//returns pointer to right subtree
+
+	//from AbstractBinarySearchTree.h ***************************************
+	bool contains(const DataType& q);							//returns true if tree contains a node with q
+	DataType find(const DataType& q);							//returns a node that matches q or throws exception
+	void insert(const DataType& data);							//inserts data and updates aggregates
+	void remove(const DataType& data);							//removes the node matching data and updates aggregates
+
+	ValueType aggregate();										//aggregate of the whole tree, O(1)
+	ValueType rangeAggregate(const DataType& low, const DataType& high);	//aggregate of low..high inclusive
+	ValueType prefixAggregate(const DataType& high);			//aggregate of every element <= high
+};
+
+
+//Empty constructor
+template <class DataType, class Monoid>
+AggregateBinarySearchTree<DataType, Monoid>::AggregateBinarySearchTree()
+{
+	_rootData = NULL;
+	_left = NULL;
+	_right = NULL;
+	_subtree = false;
+	_aggregate = Monoid::identity();
+	_priority = 0;
+}
+
+//Constructor using data to set root
+template <class DataType, class Monoid>
+AggregateBinarySearchTree<DataType, Monoid>::AggregateBinarySearchTree(const DataType& data)
+{
+	_subtree = false;
+	_rootData = new DataType(data);
+	if (_rootData == NULL) throw BinaryTreeMemory();
+	_priority = _nextPriority();
+	_left = makeSubtree();
+	_right = makeSubtree();
+	_update();
+}
+
+//Destructor
+template <class DataType, class Monoid>
+AggregateBinarySearchTree<DataType, Monoid>::~AggregateBinarySearchTree()
+{
+	if (_rootData != NULL)
+		delete _rootData;
+	_rootData = NULL;
+	if (_left != NULL)
+		delete _left;
+	_left = NULL;
+	if (_right != NULL)
+		delete _right;
+	_right = NULL;
+}
+
+//makeSubtree:  creates pointer to an empty subtree under root
+template <class DataType, class Monoid>
+AggregateBinarySearchTree<DataType, Monoid>* AggregateBinarySearchTree<DataType, Monoid>::makeSubtree()
+{
+	AggregateBinarySearchTree<DataType, Monoid>* abst = new AggregateBinarySearchTree<DataType, Monoid>();
+	if (abst == NULL) throw BinaryTreeMemory();
+	abst->_subtree = true;
+	return abst;
+}
+
+//returns true if this is a subtree, false for the root
+template <class DataType, class Monoid>
+bool AggregateBinarySearchTree<DataType, Monoid>::subtree()
+{
+	return _subtree;
+}
+
+//deletes the tree structure
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::makeEmpty()
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	if (_rootData != NULL)
+		delete _rootData;
+	if (_left != NULL)
+		delete _left;
+	if (_right != NULL)
+		delete _right;
+	_makeNull();
+	_aggregate = Monoid::identity();
+}
+
+//returns a pseudo-random priority:  a shared counter stepped by the golden ratio and mixed,
+//which trees on any number of threads may call at once
+template <class DataType, class Monoid>
+unsigned int AggregateBinarySearchTree<DataType, Monoid>::_nextPriority()
+{
+	static atomic<unsigned int> counter(0x2545F491u);
+	unsigned int x = counter.fetch_add(0x9E3779B9u, memory_order_relaxed);
+	x ^= x >> 16;
+	x *= 0x7FEB352Du;
+	x ^= x >> 15;
+	x *= 0x846CA68Bu;
+	x ^= x >> 16;
+	return x;
+}
+
+//sets all the pointers in a node to NULL
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_makeNull()
+{
+	_rootData = NULL;
+	_left = NULL;
+	_right = NULL;
+}
+
+//recomputes the aggregate of this node as left, root, right in key order
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_update()
+{
+	if (isEmpty())
+		_aggregate = Monoid::identity();
+	else
+		_aggregate = Monoid::combine(Monoid::combine(_left->_aggregate, Monoid::lift(*_rootData)),
+			_right->_aggregate);
+}
+
+//moves child's contents into this node and deletes the child's shell
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_takeOver(AggregateBinarySearchTree<DataType, Monoid>* child)
+{
+	_rootData = child->_rootData;
+	_left = child->_left;
+	_right = child->_right;
+	_aggregate = child->_aggregate;
+	_priority = child->_priority;
+	child->_makeNull();
+	delete child;
+}
+
+//_rotateLeft():  the right child's element moves up into this node and this node's element
+//moves down into the child's shell, which becomes the left child.  The shell's aggregate is
+//recomputed first, since this node's is built from it.
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_rotateLeft()
+{
+	AggregateBinarySearchTree<DataType, Monoid>* child = _right;
+	std::swap(_rootData, child->_rootData);
+	std::swap(_priority, child->_priority);
+	_right = child->_right;
+	child->_right = child->_left;
+	child->_left = _left;
+	_left = child;
+	child->_update();
+	_update();
+}
+
+//_rotateRight():  the mirror image of _rotateLeft()
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_rotateRight()
+{
+	AggregateBinarySearchTree<DataType, Monoid>* child = _left;
+	std::swap(_rootData, child->_rootData);
+	std::swap(_priority, child->_priority);
+	_left = child->_left;
+	child->_left = child->_right;
+	child->_right = _right;
+	_right = child;
+	child->_update();
+	_update();
+}
+
+
+//checks to see whether or not the tree is empty
+template <class DataType, class Monoid>
+bool AggregateBinarySearchTree<DataType, Monoid>::isEmpty()
+{
+	return (_rootData == NULL);
+}
+
+//returns the height of the tree by checking both sides via recursion
+template <class DataType, class Monoid>
+int AggregateBinarySearchTree<DataType, Monoid>::Height()
+{
+	if (isEmpty()) return 0;
+	return (1 + std::max(_left->Height(), _right->Height()));
+}
+
+//returns the number of all the nodes in the tree
+template <class DataType, class Monoid>
+int AggregateBinarySearchTree<DataType, Monoid>::Size()
+{
+	if (isEmpty())
+		return 0;
+	return (1 + _left->Size() + _right->Size());
+}
+
+//returns the data at the root
+template <class DataType, class Monoid>
+DataType& AggregateBinarySearchTree<DataType, Monoid>::rootData()
+{
+	if (isEmpty()) throw BinaryTreeEmptyTree();
+	return *_rootData;
+}
+
+//returns pointer to top of left subtree
+template <class DataType, class Monoid>
+AggregateBinarySearchTree<DataType, Monoid>* AggregateBinarySearchTree<DataType, Monoid>::left()
+{
+	return _left;
+}
+
+//returns pointer to top of right subtree
+template <class DataType, class Monoid>
+AggregateBinarySearchTree<DataType, Monoid>* AggregateBinarySearchTree<DataType, Monoid>::right()
+{
+	return _right;
+}
+
+
+//returns true if data is found in the tree, false otherwise
+template <class DataType, class Monoid>
+bool AggregateBinarySearchTree<DataType, Monoid>::contains(const DataType& q)
+{
+	AggregateBinarySearchTree<DataType, Monoid>* abst = this;
+	while (!abst->isEmpty())
+	{
+		if (*(abst->_rootData) < q)
+			abst = abst->_right;
+		else if (*(abst->_rootData) > q)
+			abst = abst->_left;
+		else
+			return true;
+	}
+	return false;
+}
+
+//returns contents of node if data is found, exception otherwise
+template <class DataType, class Monoid>
+DataType AggregateBinarySearchTree<DataType, Monoid>::find(const DataType& q)
+{
+	AggregateBinarySearchTree<DataType, Monoid>* abst = this;
+	while (!abst->isEmpty())
+	{
+		if (*(abst->_rootData) < q)
+			abst = abst->_right;
+		else if (*(abst->_rootData) > q)
+			abst = abst->_left;
+		else
+			return *(abst->_rootData);
+	}
+	throw BinarySearchTreeNotFound();
+}
+
+
+//inserts data into the tree, overwriting an equal element
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::insert(const DataType& data)
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	_insert(data);
+}
+
+//recursive insert; a new node gets a random priority and is rotated up past each parent of
+//lower priority, and each node on the path recomputes its aggregate on the way back up
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_insert(const DataType& data)
+{
+	if (isEmpty())
+	{
+		_rootData = new DataType(data);
+		if (_rootData == NULL) throw BinaryTreeMemory();
+		_priority = _nextPriority();
+		_left = makeSubtree();
+		_right = makeSubtree();
+	}
+	else if (*_rootData < data)
+	{
+		_right->_insert(data);
+		if (_right->_priority > _priority)
+		{
+			_rotateLeft();
+			return;
+		}
+	}
+	else if (*_rootData > data)
+	{
+		_left->_insert(data);
+		if (_left->_priority > _priority)
+		{
+			_rotateRight();
+			return;
+		}
+	}
+	else
+		*_rootData = data;
+	_update();
+}
+
+
+//removes the node matching data, exception if it is not present
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::remove(const DataType& data)
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	_remove(data);
+}
+
+//recursive remove; a node with two children rotates the child of higher priority up and
+//follows its element down until it has at most one child, which then takes its place
+template <class DataType, class Monoid>
+void AggregateBinarySearchTree<DataType, Monoid>::_remove(const DataType& data)
+{
+	if (isEmpty()) throw BinarySearchTreeNotFound();
+	if (*_rootData < data)
+		_right->_remove(data);
+	else if (*_rootData > data)
+		_left->_remove(data);
+	else if (_left->isEmpty())
+	{
+		delete _rootData;
+		delete _left;
+		_takeOver(_right);
+		return;													//aggregate came with the child
+	}
+	else if (_right->isEmpty())
+	{
+		delete _rootData;
+		delete _right;
+		_takeOver(_left);
+		return;
+	}
+	else if (_left->_priority > _right->_priority)
+	{
+		_rotateRight();
+		_right->_remove(data);
+	}
+	else
+	{
+		_rotateLeft();
+		_left->_remove(data);
+	}
+	_update();
+}
+
+
+//returns the aggregate of the whole tree
+template <class DataType, class Monoid>
+typename AggregateBinarySearchTree<DataType, Monoid>::ValueType AggregateBinarySearchTree<DataType, Monoid>::aggregate()
+{
+	return _aggregate;
+}
+
+//aggregate of the elements >= low.  At each node not less than low, the node and its right
+//subtree are in range and come after everything still to be found to the left.
+template <class DataType, class Monoid>
+typename AggregateBinarySearchTree<DataType, Monoid>::ValueType AggregateBinarySearchTree<DataType, Monoid>::_aggregateAtLeast(const DataType& low)
+{
+	ValueType result = Monoid::identity();
+	AggregateBinarySearchTree<DataType, Monoid>* abst = this;
+	while (!abst->isEmpty())
+	{
+		if (*(abst->_rootData) < low)
+			abst = abst->_right;
+		else
+		{
+			result = Monoid::combine(Monoid::combine(Monoid::lift(*(abst->_rootData)), abst->_right->_aggregate), result);
+			abst = abst->_left;
+		}
+	}
+	return result;
+}
+
+//aggregate of the elements <= high, the mirror image of _aggregateAtLeast
+template <class DataType, class Monoid>
+typename AggregateBinarySearchTree<DataType, Monoid>::ValueType AggregateBinarySearchTree<DataType, Monoid>::_aggregateAtMost(const DataType& high)
+{
+	ValueType result = Monoid::identity();
+	AggregateBinarySearchTree<DataType, Monoid>* abst = this;
+	while (!abst->isEmpty())
+	{
+		if (*(abst->_rootData) > high)
+			abst = abst->_left;
+		else
+		{
+			result = Monoid::combine(result, Monoid::combine(abst->_left->_aggregate, Monoid::lift(*(abst->_rootData))));
+			abst = abst->_right;
+		}
+	}
+	return result;
+}
+
+//aggregate of the elements from low to high inclusive.  Descends to the first node inside the
+//range, where the paths to low and high split, then adds up the two boundary paths.
+template <class DataType, class Monoid>
+typename AggregateBinarySearchTree<DataType, Monoid>::ValueType AggregateBinarySearchTree<DataType, Monoid>::rangeAggregate
+	(const DataType& low, const DataType& high)
+{
+	AggregateBinarySearchTree<DataType, Monoid>* abst = this;
+	while (!abst->isEmpty())
+	{
+		if (*(abst->_rootData) < low)
+			abst = abst->_right;
+		else if (*(abst->_rootData) > high)
+			abst = abst->_left;
+		else
+			return Monoid::combine(Monoid::combine(abst->_left->_aggregateAtLeast(low), Monoid::lift(*(abst->_rootData))),
+				abst->_right->_aggregateAtMost(high));
+	}
+	return Monoid::identity();
+}
+
+//aggregate of every element not greater than high
+template <class DataType, class Monoid>
+typename AggregateBinarySearchTree<DataType, Monoid>::ValueType AggregateBinarySearchTree<DataType, Monoid>::prefixAggregate(const DataType& high)
+{
+	return _aggregateAtMost(high);
+}
+
+
+#endif	//_AGGREGATEBINARYSEARCHTREE_H
@@ -0,0 +1,242 @@
+/*	AllPairsShortestPaths.h
+*	AllPairsShortestPaths computes the distance between every pair of vertices with a blocked
+*	Floyd-Warshall algorithm, meant for the dense graphs of up to a few thousand vertices that
+*	AdjacencyMatrixGraph holds.  The weights are copied into one contiguous matrix whose row
+*	length is padded to a whole number of tiles.  Each round of the algorithm works tile by
+*	tile:  first the diagonal tile of the round, then the tiles in its row and column, then
+*	all the remaining tiles.  Every tile update reads only three tiles, which stay in cache,
+*	and the tiles of each phase are independent, so they are shared out over a ThreadPool.
+*	The inner loop is a plain min-plus over restrict-qualified rows so the compiler can
+*	vectorize it.
+*
+*	Negative weights are allowed.  hasNegativeCycle() reports if one makes distances
+*	meaningless.  An optional next-hop matrix records the first step of each shortest path so
+*	paths can be rebuilt.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _ALLPAIRSSHORTESTPATHS_H
+#define _ALLPAIRSSHORTESTPATHS_H
+
+#include <vector>
+#include <limits>
+#include "AbstractGraph.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+class GraphNextHopsNotKept : public GraphException { };
+
+const int APSP_TILE = 64;										//tile edge; three tiles of doubles fit in L2
+
+
+class AllPairsShortestPaths
+{
+protected:
+	int _vertexCount;
+	int _stride;												//row length, a multiple of APSP_TILE
+	vector<double> _dist;										//distance matrix, row-major
+	vector<int> _next;											//next hop matrix, empty if not kept
+
+	void _solve(ThreadPool& pool);								//runs the blocked algorithm
+	void _tile(int ib, int jb, int kb);							//relaxes tile (ib, jb) through tile row kb
+	void _tileNext(int ib, int jb, int kb);						//as _tile(), also updating next hops
+	void _checkVertex(int v);
+
+public:
+	template <class VertexObject, class EdgeObject>
+	AllPairsShortestPaths(AbstractGraph<VertexObject, EdgeObject>& g, ThreadPool& pool, bool keepNextHops = false);
+	virtual ~AllPairsShortestPaths();
+
+	int vertexCount();											//returns the number of vertices
+	double distance(int start, int end);						//infinity if end cannot be reached
+	const double* distanceRow(int start);						//distances from start to vertices 0 .. n-1
+	int nextHop(int start, int end);							//first vertex after start on a shortest path
+	void path(int start, int end, vector<int>& path);			//vertices of a shortest path, empty if none
+	bool hasNegativeCycle();									//true if any vertex reaches itself below 0
+};
+
+
+//constructor -- copies the weights of g and solves.  Missing edges have infinite distance.
+//With keepNextHops the first step of every shortest path is kept for nextHop() and path().
+template <class VertexObject, class EdgeObject>
+AllPairsShortestPaths::AllPairsShortestPaths(AbstractGraph<VertexObject, EdgeObject>& g, ThreadPool& pool, bool keepNextHops)
+{
+	_vertexCount = g.vertexCount();
+	_stride = ((_vertexCount + APSP_TILE - 1) / APSP_TILE) * APSP_TILE;
+	_dist.assign((size_t)_stride * _stride, numeric_limits<double>::infinity());
+	if (keepNextHops) _next.assign((size_t)_stride * _stride, -1);
+	for (int v = 0; v < _vertexCount; v++)
+	{
+		double* row = _dist.data() + (size_t)v * _stride;
+		vector<int> nbors = g.neighbors(v);
+		for (unsigned int i = 0; i < nbors.size(); i++)
+		{
+			int w = nbors[i];
+			double weight = g.edgeWeight(v, w);
+			if (weight < row[w]) row[w] = weight;
+			if (keepNextHops) _next[(size_t)v * _stride + w] = w;
+		}
+		if (row[v] > 0)
+		{
+			row[v] = 0;
+			if (keepNextHops) _next[(size_t)v * _stride + v] = v;
+		}
+	}
+	_solve(pool);
+}
+
+//destructor
+inline AllPairsShortestPaths::~AllPairsShortestPaths() { }
+
+
+//_tile():  for every k in tile row kb, lowers dist[i][j] to dist[i][k] + dist[k][j] over the
+//tile (ib, jb).  k is the outer loop, so the same routine is correct for the diagonal tile and
+//for the row and column tiles, which read entries they also write.
+inline void AllPairsShortestPaths::_tile(int ib, int jb, int kb)
+{
+	double* d = _dist.data();
+	size_t stride = _stride;
+	for (int k = kb * APSP_TILE; k < (kb + 1) * APSP_TILE; k++)
+	{
+		const double* __restrict kRow = d + k * stride + jb * APSP_TILE;
+		for (int i = ib * APSP_TILE; i < (ib + 1) * APSP_TILE; i++)
+		{
+			double* __restrict iRow = d + i * stride + jb * APSP_TILE;
+			double dik = d[i * stride + k];
+			for (int j = 0; j < APSP_TILE; j++)
+			{
+				double candidate = dik + kRow[j];
+				iRow[j] = (candidate < iRow[j]) ? candidate : iRow[j];
+			}
+		}
+	}
+}
+
+//_tileNext():  _tile() that also sets next[i][j] = next[i][k] wherever a distance drops
+inline void AllPairsShortestPaths::_tileNext(int ib, int jb, int kb)
+{
+	double* d = _dist.data();
+	int* next = _next.data();
+	size_t stride = _stride;
+	for (int k = kb * APSP_TILE; k < (kb + 1) * APSP_TILE; k++)
+	{
+		const double* __restrict kRow = d + k * stride + jb * APSP_TILE;
+		for (int i = ib * APSP_TILE; i < (ib + 1) * APSP_TILE; i++)
+		{
+			double* __restrict iRow = d + i * stride + jb * APSP_TILE;
+			int* __restrict iNext = next + i * stride + jb * APSP_TILE;
+			double dik = d[i * stride + k];
+			int nik = next[i * stride + k];
+			for (int j = 0; j < APSP_TILE; j++)
+			{
+				double candidate = dik + kRow[j];
+				bool better = candidate < iRow[j];
+				iRow[j] = better ? candidate : iRow[j];
+				iNext[j] = better ? nik : iNext[j];
+			}
+		}
+	}
+}
+
+//_solve():  one round per tile row kb.  The diagonal tile is done first, then the other tiles
+//of row kb and column kb in parallel, then every remaining tile in parallel.
+inline void AllPairsShortestPaths::_solve(ThreadPool& pool)
+{
+	int tiles = _stride / APSP_TILE;
+	bool keepNext = !_next.empty();
+	for (int kb = 0; kb < tiles; kb++)
+	{
+		if (keepNext) _tileNext(kb, kb, kb);
+		else _tile(kb, kb, kb);
+
+		//tiles 0 .. tiles-1 are row tiles (kb, t), tiles .. 2*tiles-1 are column tiles (t, kb)
+		pool.parallelFor(0, 2 * tiles, 1, [&](int low, int high, int /*thread*/)
+		{
+			for (int t = low; t < high; t++)
+			{
+				int ib = (t < tiles) ? kb : t - tiles;
+				int jb = (t < tiles) ? t : kb;
+				if ((ib == kb) && (jb == kb)) continue;
+				if (keepNext) _tileNext(ib, jb, kb);
+				else _tile(ib, jb, kb);
+			}
+		});
+
+		pool.parallelFor(0, tiles * tiles, 1, [&](int low, int high, int /*thread*/)
+		{
+			for (int t = low; t < high; t++)
+			{
+				int ib = t / tiles;
+				int jb = t % tiles;
+				if ((ib == kb) || (jb == kb)) continue;
+				if (keepNext) _tileNext(ib, jb, kb);
+				else _tile(ib, jb, kb);
+			}
+		});
+	}
+}
+
+//throws if v is not a vertex
+inline void AllPairsShortestPaths::_checkVertex(int v)
+{
+	if ((v < 0) || (v >= _vertexCount)) throw GraphVertexOutOfBounds();
+}
+
+//returns the number of vertices
+inline int AllPairsShortestPaths::vertexCount()
+{
+	return _vertexCount;
+}
+
+//returns the shortest distance from start to end, infinity if there is no path
+inline double AllPairsShortestPaths::distance(int start, int end)
+{
+	_checkVertex(start);
+	_checkVertex(end);
+	return _dist[(size_t)start * _stride + end];
+}
+
+//returns the row of distances from start; entries past vertexCount() are padding
+inline const double* AllPairsShortestPaths::distanceRow(int start)
+{
+	_checkVertex(start);
+	return _dist.data() + (size_t)start * _stride;
+}
+
+//returns the vertex after start on a shortest path to end, -1 if there is no path.  Throws
+//GraphNextHopsNotKept unless the object was built with keepNextHops.
+inline int AllPairsShortestPaths::nextHop(int start, int end)
+{
+	_checkVertex(start);
+	_checkVertex(end);
+	if (_next.empty()) throw GraphNextHopsNotKept();
+	return _next[(size_t)start * _stride + end];
+}
+
+//path():  fills path with the vertices of a shortest path from start to end, both included,
+//or leaves it empty if there is none.  Requires keepNextHops.
+inline void AllPairsShortestPaths::path(int start, int end, vector<int>& path)
+{
+	path.clear();
+	if (nextHop(start, end) < 0) return;
+	path.push_back(start);
+	for (int v = start; v != end; )
+	{
+		v = _next[(size_t)v * _stride + end];
+		path.push_back(v);
+		if ((int)path.size() > _vertexCount) break;			//only possible with a negative cycle
+	}
+}
+
+//returns true if a negative cycle was found, in which case some distances are not defined
+inline bool AllPairsShortestPaths::hasNegativeCycle()
+{
+	for (int v = 0; v < _vertexCount; v++)
+		if (_dist[(size_t)v * _stride + v] < 0) return true;
+	return false;
+}
+
+
+#endif	//_ALLPAIRSSHORTESTPATHS_H
@@ -5,8 +5,14 @@
 *	Date:	 August 1, 2017
 */
 
+#ifndef _BINARYSEARCHTREE_H
+#define _BINARYSEARCHTREE_H
+
 #include <iostream>
 #include <algorithm>
+#include <utility>
+#include <vector>
+#include <stack>
 #include "Exception.h"
 #include "AbstractBinarySearchTree.h"
 
@@ -24,8 +30,12 @@ protected:
 	BinarySearchTree<DataType>* _left;							//pointer to left subtree
 	BinarySearchTree<DataType>* _right;							//pointer to right subtree
 	bool _subtree;												//true if tree contains a subtree
+	bool _adaptive;												//true if lookups splay the found node to the root
 	void copyTree(BinarySearchTree<DataType>* bat);				//copies one tree to another
 	void _makeNull();											//sets all pointers to NULL
+	void _buildBalanced(const vector<DataType>& sorted, int low, int high);	//builds subtree from sorted[low, high)
+	void _splay(const DataType& data);							//moves data, or its last neighbor, to the root
+	DataType* _lookup(const DataType& q);						//shared search for contains/find/findPtr
 
 public:
 	BinarySearchTree();											//empty constructor
@@ -33,8 +43,18 @@ public:
 	virtual ~BinarySearchTree();								//destructor
 	BinarySearchTree<DataType>* makeSubtree();					//creates an empty subtree
 	bool subtree();												//returns value of _subtree
+	void setAdaptive(bool adaptive);							//turns splaying on lookup on or off
+	bool adaptive();											//returns value of _adaptive
+	int depth(const DataType& q);								//returns number of nodes a search for q visits
 	void makeEmpty();											//deletes the structure of the tree
+	void buildFromSorted(const vector<DataType>& sorted);		//replaces contents with a balanced tree in O(n)
+	void toSortedVector(vector<DataType>& sorted);				//appends the data to sorted in order
 	BinarySearchTree<DataType>* _find(const DataType& data);	//protected find method to return pointer to node
+	DataType* findPtr(const DataType& q);						//returns pointer to the match, NULL if not found
+	bool tryInsert(const DataType& data);						//inserts only if absent, true if inserted
+	bool insertOrAssign(const DataType& data);					//inserts or assigns in place, true if inserted
+	template <class... Args>
+	bool emplace(Args&&... args);								//constructs data in place if absent, true if inserted
 
 	//from AbstractBinaryTreeAccess.h ************************************
 	bool isEmpty();								//true if tree is empty, false otherwise
@@ -54,7 +74,6 @@ public:
 	DataType find(const DataType& q);					//returns a node that matches q or throws exception
 	void insert(const DataType& data);					//inserts data while maintaining binary search properties
 	void remove(const DataType& data);					//removes the node matching data if present
-//	virtual void rangeSearch(DataType& low, DataType& high) = NULL;
 
 
 };
@@ -68,6 +87,7 @@ BinarySearchTree<DataType>::BinarySearchTree()
 	_left = NULL;
 	_right = NULL;
 	_subtree = false;
+	_adaptive = false;
 }
 
 
@@ -76,6 +96,7 @@ template <class DataType>
 BinarySearchTree<DataType>::BinarySearchTree(const DataType& data)
 {
 	_subtree = false;
+	_adaptive = false;
 	_rootData = new DataType(data);
 	if (_rootData == NULL) throw BinaryTreeMemory();
 	_left = makeSubtree();
@@ -105,6 +126,7 @@ BinarySearchTree<DataType>* BinarySearchTree<DataType>::makeSubtree()
 {
 	BinarySearchTree<DataType>* bat = new BinarySearchTree<DataType>();	//dynamically create new subtree
 	bat->_subtree = true;
+	bat->_adaptive = false;
 	return bat;
 }
 
@@ -150,6 +172,25 @@ bool BinarySearchTree<DataType>::subtree()
 }
 
 
+//turns adaptive mode on or off.  In adaptive mode every lookup and insert splays the key it
+//touched to the root, so keys that are accessed often stay a few levels from the top and
+//skewed (e.g. Zipf) workloads search much shorter paths.  Only the root tree can be adaptive.
+template <class DataType>
+void BinarySearchTree<DataType>::setAdaptive(bool adaptive)
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	_adaptive = adaptive;
+}
+
+
+//returns true if the tree is in adaptive mode
+template <class DataType>
+bool BinarySearchTree<DataType>::adaptive()
+{
+	return _adaptive;
+}
+
+
 //returns the height of the tree by checking both sides via recursion
 template <class DataType>
 int BinarySearchTree<DataType>::Height()
@@ -198,6 +239,57 @@ void BinarySearchTree<DataType>::copyTree(BinarySearchTree<DataType>* bst)
 }
 
 
+//replaces the tree with a height-balanced tree holding sorted, which must be in ascending
+//order with no duplicates.  Each element is copied once, so the build is O(n).
+template <class DataType>
+void BinarySearchTree<DataType>::buildFromSorted(const vector<DataType>& sorted)
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	makeEmpty();
+	_buildBalanced(sorted, 0, (int)sorted.size());
+}
+
+
+//builds the subtree rooted at this node from sorted[low, high) using the middle as the root
+template <class DataType>
+void BinarySearchTree<DataType>::_buildBalanced(const vector<DataType>& sorted, int low, int high)
+{
+	if (low >= high)
+		return;
+	int mid = low + (high - low) / 2;
+	_rootData = new DataType(sorted[mid]);
+	if (_rootData == NULL) throw BinaryTreeMemory();
+	_left = makeSubtree();
+	_right = makeSubtree();
+	_left->_buildBalanced(sorted, low, mid);
+	_right->_buildBalanced(sorted, mid + 1, high);
+}
+
+
+//appends the data of the tree to sorted using an iterative inorder walk
+template <class DataType>
+void BinarySearchTree<DataType>::toSortedVector(vector<DataType>& sorted)
+{
+	stack<BinarySearchTree<DataType>*> S;
+	BinarySearchTree<DataType>* bst = this;
+	while ((!bst->isEmpty()) || (!S.empty()))
+	{
+		if (!bst->isEmpty())
+		{
+			S.push(bst);
+			bst = bst->_left;
+		}
+		else
+		{
+			bst = S.top();
+			S.pop();
+			sorted.push_back(*(bst->_rootData));
+			bst = bst->_right;
+		}
+	}
+}
+
+
 //sets all the pointers in a node to NULL
 template <class DataType>
 void BinarySearchTree<DataType>::_makeNull()
@@ -227,13 +319,131 @@ BinarySearchTree<DataType>* BinarySearchTree<DataType>::_find(const DataType& da
 }
 
 
+//returns the number of non-empty nodes visited while searching for q, without splaying
+template <class DataType>
+int BinarySearchTree<DataType>::depth(const DataType& q)
+{
+	int count = 0;
+	BinarySearchTree<DataType>* bst = this;
+	while (!bst->isEmpty())
+	{
+		count++;
+		if (*(bst->_rootData) < q)
+			bst = bst->_right;
+		else if (*(bst->_rootData) > q)
+			bst = bst->_left;
+		else
+			break;
+	}
+	return count;
+}
+
+
+//_splay():  top-down splay of Sleator and Tarjan.  Walks down from the root, breaking the
+//tree into a left tree of smaller keys and a right tree of larger keys, rotating on zig-zig
+//steps, then reassembles with the last node reached as the root.  The root object must stay
+//the root, so its contents are moved to a working node first and the new root's contents are
+//moved back into it at the end.
+template <class DataType>
+void BinarySearchTree<DataType>::_splay(const DataType& data)
+{
+	if (isEmpty()) return;
+	if (*_rootData < data)
+	{
+		if (_right->isEmpty()) return;
+	}
+	else if (*_rootData > data)
+	{
+		if (_left->isEmpty()) return;
+	}
+	else
+		return;												//already at the root
+
+	BinarySearchTree<DataType>* t = makeSubtree();
+	t->_rootData = _rootData;
+	t->_left = _left;
+	t->_right = _right;
+
+	BinarySearchTree<DataType>* leftRoot = NULL;				//left tree, keys less than data
+	BinarySearchTree<DataType>* leftMax = NULL;					//right-most node of the left tree
+	BinarySearchTree<DataType>* rightRoot = NULL;				//right tree, keys greater than data
+	BinarySearchTree<DataType>* rightMin = NULL;				//left-most node of the right tree
+	BinarySearchTree<DataType>* y;
+	while (true)
+	{
+		if (data < *(t->_rootData))
+		{
+			if (t->_left->isEmpty()) break;
+			if (data < *(t->_left->_rootData))				//zig-zig:  rotate right
+			{
+				y = t->_left;
+				t->_left = y->_right;
+				y->_right = t;
+				t = y;
+				if (t->_left->isEmpty()) break;
+			}
+			if (rightMin == NULL) rightRoot = t;			//link t into the right tree
+			else rightMin->_left = t;
+			rightMin = t;
+			t = t->_left;
+		}
+		else if (data > *(t->_rootData))
+		{
+			if (t->_right->isEmpty()) break;
+			if (data > *(t->_right->_rootData))				//zig-zig:  rotate left
+			{
+				y = t->_right;
+				t->_right = y->_left;
+				y->_left = t;
+				t = y;
+				if (t->_right->isEmpty()) break;
+			}
+			if (leftMax == NULL) leftRoot = t;				//link t into the left tree
+			else leftMax->_right = t;
+			leftMax = t;
+			t = t->_right;
+		}
+		else
+			break;
+	}
+
+	//reassemble:  t's subtrees go to the inner edges of the left and right trees
+	if (leftMax == NULL) leftRoot = t->_left;
+	else leftMax->_right = t->_left;
+	if (rightMin == NULL) rightRoot = t->_right;
+	else rightMin->_left = t->_right;
+
+	_rootData = t->_rootData;
+	_left = leftRoot;
+	_right = rightRoot;
+	t->_makeNull();
+	delete t;
+}
+
+
+//searches for q, splaying it to the root first when the tree is adaptive.  Returns a pointer
+//to the matching data or NULL.
+template <class DataType>
+DataType* BinarySearchTree<DataType>::_lookup(const DataType& q)
+{
+	if (_adaptive)
+	{
+		_splay(q);
+		if (isEmpty() || (*_rootData < q) || (*_rootData > q))
+			return NULL;
+		return _rootData;
+	}
+	return _find(q)->_rootData;									//NULL when the node is an empty subtree
+}
+
+
 //returns contents of node if data is found, exception otherwise
 template <class DataType>
 DataType BinarySearchTree<DataType>::find(const DataType& q)
 {
-	BinarySearchTree<DataType>* bst = _find(q);
-	if (bst->isEmpty()) throw BinarySearchTreeNotFound();
-	return bst->rootData();
+	DataType* data = _lookup(q);
+	if (data == NULL) throw BinarySearchTreeNotFound();
+	return *data;
 }
 
 
@@ -241,28 +451,85 @@ DataType BinarySearchTree<DataType>::find(const DataType& q)
 template <class DataType>
 bool BinarySearchTree<DataType>::contains(const DataType& q)
 {
-	BinarySearchTree<DataType>* bst = _find(q);
-	return !bst->isEmpty();
+	return (_lookup(q) != NULL);
+}
+
+
+//returns pointer to the data in the matching node, NULL if not found.  Unlike find(), this
+//neither copies the data nor throws on a miss.
+template <class DataType>
+DataType* BinarySearchTree<DataType>::findPtr(const DataType& q)
+{
+	return _lookup(q);
 }
 
 
 //inserts data into the appropriate node of the tree, creating one if necessary
 template <class DataType>
 void BinarySearchTree<DataType>::insert(const DataType& data)
+{
+	insertOrAssign(data);
+}
+
+
+//inserts data only if no matching node exists; an existing node is left untouched
+template <class DataType>
+bool BinarySearchTree<DataType>::tryInsert(const DataType& data)
 {
 	if (_subtree) throw BinarySearchTreeChangedSubtree();
 	BinarySearchTree<DataType>* bst = _find(data);
-	if (bst->isEmpty())
+	if (!bst->isEmpty())
+		return false;
+	bst->_rootData = new DataType(data);
+	if (bst->_rootData == NULL) throw BinaryTreeMemory();
+	bst->_left = makeSubtree();
+	bst->_right = makeSubtree();
+	if (_adaptive) _splay(data);
+	return true;
+}
+
+
+//inserts data, or assigns it over the matching node's data without reallocating
+template <class DataType>
+bool BinarySearchTree<DataType>::insertOrAssign(const DataType& data)
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	BinarySearchTree<DataType>* bst = _find(data);
+	if (!bst->isEmpty())
 	{
-		bst->_rootData = new DataType(data);
-		bst->_left = makeSubtree();
-		bst->_right = makeSubtree();
+		*(bst->_rootData) = data;
+		if (_adaptive) _splay(data);
+		return false;
 	}
-	else
+	bst->_rootData = new DataType(data);
+	if (bst->_rootData == NULL) throw BinaryTreeMemory();
+	bst->_left = makeSubtree();
+	bst->_right = makeSubtree();
+	if (_adaptive) _splay(data);
+	return true;
+}
+
+
+//constructs the data from args directly in its node if no matching node exists.  The new
+//object is built first so that it can be compared, and is discarded on a match.
+template <class DataType>
+template <class... Args>
+bool BinarySearchTree<DataType>::emplace(Args&&... args)
+{
+	if (_subtree) throw BinarySearchTreeChangedSubtree();
+	DataType* data = new DataType(std::forward<Args>(args)...);
+	if (data == NULL) throw BinaryTreeMemory();
+	BinarySearchTree<DataType>* bst = _find(*data);
+	if (!bst->isEmpty())
 	{
-		delete bst->_rootData;
-		bst->_rootData = new DataType(data);
+		delete data;
+		return false;
 	}
+	bst->_rootData = data;
+	bst->_left = makeSubtree();
+	bst->_right = makeSubtree();
+	if (_adaptive) _splay(*data);
+	return true;
 }
 
 
@@ -325,3 +592,4 @@ void BinarySearchTree<DataType>::remove(const DataType& data)
 }
 
 
+#endif	//_BINARYSEARCHTREE_H
@@ -0,0 +1,351 @@
+/*	BinarySearchTreeFile.h
+*	Binary checkpoint files for BinarySearchTree.  The keys are written once in sorted order
+*	after a fixed 32-byte header, either as raw fixed-size records or, for integer keys, as
+*	variable-length encoded differences between neighbouring keys.  Loading maps the file and
+*	rebuilds a balanced tree with BinarySearchTree::buildFromSorted() in O(n), after checking
+*	that the keys are strictly ascending.
+*
+*	A save writes filename.tmp, checks that every byte reached it and then renames it over
+*	filename, so a crash or a full disk part-way through leaves the previous checkpoint whole.
+*
+*	A raw file can also be searched where it lies:  MappedBinarySearchTree maps the file
+*	read-only and answers contains/find/lowerBound by binary search over the mapped keys,
+*	without building a tree at all.
+*
+*	Keys must be trivially copyable; the file uses the byte order of the machine that wrote it.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _BINARYSEARCHTREEFILE_H
+#define _BINARYSEARCHTREEFILE_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <climits>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#include "Exception.h"
+#include "MappedFile.h"
+#include "BinarySearchTree.h"
+
+using namespace std;
+
+class BinarySearchTreeFileError : public BinaryTreeException { };
+class BinarySearchTreeFileFormat : public BinarySearchTreeFileError { };
+
+const uint32_t BST_FILE_VERSION = 1;
+const uint32_t BST_FILE_DELTA = 1;								//flag:  keys are delta encoded
+const int BST_FILE_BUFFER_SIZE = 1 << 20;						//bytes buffered per write
+
+
+//BinarySearchTreeFileHeader -- 32 bytes, so raw keys after it stay aligned in a mapping
+struct BinarySearchTreeFileHeader
+{
+	char magic[4];												//"BSTF"
+	uint32_t version;											//BST_FILE_VERSION
+	uint32_t flags;												//BST_FILE_DELTA or 0
+	uint32_t keySize;											//sizeof(DataType) of the writer
+	uint64_t count;												//number of keys
+	uint64_t reserved;
+};
+
+template <class DataType> class MappedBinarySearchTree;
+
+
+template <class DataType>
+class BinarySearchTreeFile
+{
+protected:
+	static void _writeHeader(ofstream& out, uint64_t count, uint32_t flags);
+	static bool _replaceFile(const char* from, const char* to);	//renames from over to, true on success
+	static const BinarySearchTreeFileHeader* _checkHeader(const MappedFile& file);
+	static void _writeDelta(ofstream& out, const vector<DataType>& keys, true_type);
+	static void _writeDelta(ofstream& out, const vector<DataType>& keys, false_type);
+	static void _readDelta(const unsigned char* p, const unsigned char* end, vector<DataType>& keys,
+		uint64_t count, true_type);
+	static void _readDelta(const unsigned char* p, const unsigned char* end, vector<DataType>& keys,
+		uint64_t count, false_type);
+
+public:
+	static void save(BinarySearchTree<DataType>& bst, const char* filename, bool deltaEncode = false);
+																//writes the keys of bst in sorted order
+	static void load(BinarySearchTree<DataType>& bst, const char* filename);
+																//replaces bst with a balanced tree of the file's keys
+	friend class MappedBinarySearchTree<DataType>;
+};
+
+
+//MappedBinarySearchTree -- read-only search directly over a raw (not delta encoded) file
+template <class DataType>
+class MappedBinarySearchTree
+{
+protected:
+	MappedFile _file;
+	const DataType* _keys;										//sorted keys inside the mapping
+	int _size;													//number of keys
+	int _lowerBound(const DataType& q) const;					//index of first key >= q, _size if none
+
+public:
+	MappedBinarySearchTree(const char* filename);				//maps filename
+	virtual ~MappedBinarySearchTree();							//unmaps the file
+
+	bool isEmpty() const;										//true if the file holds no keys
+	int Size() const;											//returns the number of keys
+	bool contains(const DataType& q) const;						//returns true if a key matches q
+	DataType find(const DataType& q) const;						//returns the matching key or throws exception
+	const DataType* lowerBound(const DataType& q) const;		//returns first key >= q, NULL if none
+};
+
+
+//writes the fixed header
+template <class DataType>
+void BinarySearchTreeFile<DataType>::_writeHeader(ofstream& out, uint64_t count, uint32_t flags)
+{
+	BinarySearchTreeFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "BSTF", 4);
+	header.version = BST_FILE_VERSION;
+	header.flags = flags;
+	header.keySize = (uint32_t)sizeof(DataType);
+	header.count = count;
+	out.write((const char*)&header, sizeof(header));
+}
+
+//validates the header of a mapped file and returns it.  The count must fit the int sizes of
+//the trees, and raw keys must fit in the file; the bound is a division so it cannot overflow.
+template <class DataType>
+const BinarySearchTreeFileHeader* BinarySearchTreeFile<DataType>::_checkHeader(const MappedFile& file)
+{
+	if (file.size() < sizeof(BinarySearchTreeFileHeader)) throw BinarySearchTreeFileFormat();
+	const BinarySearchTreeFileHeader* header = (const BinarySearchTreeFileHeader*)file.data();
+	if ((memcmp(header->magic, "BSTF", 4) != 0) || (header->version != BST_FILE_VERSION)
+		|| (header->keySize != sizeof(DataType)))
+		throw BinarySearchTreeFileFormat();
+	if (header->count > (uint64_t)INT_MAX) throw BinarySearchTreeFileFormat();
+	if (((header->flags & BST_FILE_DELTA) == 0)
+		&& (header->count > (file.size() - sizeof(BinarySearchTreeFileHeader)) / sizeof(DataType)))
+		throw BinarySearchTreeFileFormat();
+	return header;
+}
+
+
+//replaces the file to with the file from in one step, so a reader sees one or the other
+template <class DataType>
+bool BinarySearchTreeFile<DataType>::_replaceFile(const char* from, const char* to)
+{
+#if defined(_WIN32)
+	return (MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0);
+#else
+	return (rename(from, to) == 0);
+#endif
+}
+
+//save():  writes the header followed by the keys in ascending order to filename.tmp, then
+//renames it over filename once the stream reports every byte written.  Requests that cannot
+//be written are refused before anything is opened, and on any failure the temporary file is
+//removed, so an existing checkpoint is never truncated or half overwritten.
+template <class DataType>
+void BinarySearchTreeFile<DataType>::save(BinarySearchTree<DataType>& bst, const char* filename, bool deltaEncode)
+{
+	static_assert(is_trivially_copyable<DataType>::value, "BinarySearchTreeFile requires trivially copyable keys");
+	if (deltaEncode && !is_integral<DataType>::value) throw BinarySearchTreeFileFormat();
+	vector<DataType> keys;
+	bst.toSortedVector(keys);
+
+	string temporary = string(filename) + ".tmp";
+	ofstream out(temporary.c_str(), ios::out | ios::binary | ios::trunc);
+	if (!out) throw BinarySearchTreeFileError();
+	_writeHeader(out, keys.size(), deltaEncode ? BST_FILE_DELTA : 0);
+	if (deltaEncode)
+		_writeDelta(out, keys, typename is_integral<DataType>::type());
+	else if (!keys.empty())
+		out.write((const char*)keys.data(), keys.size() * sizeof(DataType));
+	out.flush();
+	bool written = out.good();
+	out.close();
+	if ((!written) || (!out) || (!_replaceFile(temporary.c_str(), filename)))
+	{
+		remove(temporary.c_str());
+		throw BinarySearchTreeFileError();
+	}
+}
+
+
+//_writeDelta():  each key after the first is stored as its unsigned difference from the key
+//before it, 7 bits per byte with the high bit marking that more bytes follow
+template <class DataType>
+void BinarySearchTreeFile<DataType>::_writeDelta(ofstream& out, const vector<DataType>& keys, true_type)
+{
+	vector<unsigned char> buffer;
+	buffer.reserve(BST_FILE_BUFFER_SIZE + 16);
+	uint64_t previous = 0;
+	for (size_t i = 0; i < keys.size(); i++)
+	{
+		uint64_t value = (uint64_t)keys[i];
+		uint64_t delta = value - previous;						//wraps correctly for signed keys
+		previous = value;
+		while (delta >= 0x80)
+		{
+			buffer.push_back((unsigned char)(delta | 0x80));
+			delta >>= 7;
+		}
+		buffer.push_back((unsigned char)delta);
+		if (buffer.size() >= (size_t)BST_FILE_BUFFER_SIZE)
+		{
+			out.write((const char*)buffer.data(), buffer.size());
+			buffer.clear();
+		}
+	}
+	if (!buffer.empty())
+		out.write((const char*)buffer.data(), buffer.size());
+}
+
+//delta encoding is only defined for integer keys; save() refuses it before this is reached
+template <class DataType>
+void BinarySearchTreeFile<DataType>::_writeDelta(ofstream& /*out*/, const vector<DataType>& /*keys*/, false_type)
+{
+	throw BinarySearchTreeFileFormat();
+}
+
+
+//load():  maps the file, decodes the keys and builds a balanced tree from them.  The keys must
+//be strictly ascending, as save() writes them; anything else is a damaged or foreign file and
+//is rejected before bst changes.
+template <class DataType>
+void BinarySearchTreeFile<DataType>::load(BinarySearchTree<DataType>& bst, const char* filename)
+{
+	static_assert(is_trivially_copyable<DataType>::value, "BinarySearchTreeFile requires trivially copyable keys");
+	MappedFile file(filename);
+	const BinarySearchTreeFileHeader* header = _checkHeader(file);
+	const unsigned char* p = (const unsigned char*)file.data() + sizeof(BinarySearchTreeFileHeader);
+	const unsigned char* end = (const unsigned char*)file.data() + file.size();
+
+	vector<DataType> keys;
+	if (header->flags & BST_FILE_DELTA)
+		_readDelta(p, end, keys, header->count, typename is_integral<DataType>::type());
+	else
+	{
+		keys.resize((size_t)header->count);
+		if (!keys.empty())
+			memcpy(keys.data(), p, keys.size() * sizeof(DataType));
+	}
+	for (size_t i = 1; i < keys.size(); i++)
+		if (!(keys[i - 1] < keys[i])) throw BinarySearchTreeFileFormat();
+	bst.buildFromSorted(keys);
+}
+
+//decodes count delta-encoded keys.  Every key takes at least one byte, so a count larger than
+//the data is rejected before anything is reserved for it.
+template <class DataType>
+void BinarySearchTreeFile<DataType>::_readDelta(const unsigned char* p, const unsigned char* end,
+	vector<DataType>& keys, uint64_t count, true_type)
+{
+	if (count > (uint64_t)(end - p)) throw BinarySearchTreeFileFormat();
+	keys.reserve((size_t)count);
+	uint64_t value = 0;
+	for (uint64_t i = 0; i < count; i++)
+	{
+		uint64_t delta = 0;
+		int shift = 0;
+		while (true)
+		{
+			if ((p >= end) || (shift > 63)) throw BinarySearchTreeFileFormat();
+			unsigned char byte = *p++;
+			delta |= (uint64_t)(byte & 0x7F) << shift;
+			if ((byte & 0x80) == 0) break;
+			shift += 7;
+		}
+		value += delta;
+		keys.push_back((DataType)value);
+	}
+}
+
+//a delta encoded file cannot hold non-integer keys
+template <class DataType>
+void BinarySearchTreeFile<DataType>::_readDelta(const unsigned char* /*p*/, const unsigned char* /*end*/,
+	vector<DataType>& /*keys*/, uint64_t /*count*/, false_type)
+{
+	throw BinarySearchTreeFileFormat();
+}
+
+
+//constructor -- maps the file and checks that its keys can be searched in place
+template <class DataType>
+MappedBinarySearchTree<DataType>::MappedBinarySearchTree(const char* filename)
+	: _file(filename)
+{
+	static_assert(is_trivially_copyable<DataType>::value, "MappedBinarySearchTree requires trivially copyable keys");
+	const BinarySearchTreeFileHeader* header = BinarySearchTreeFile<DataType>::_checkHeader(_file);
+	if (header->flags & BST_FILE_DELTA) throw BinarySearchTreeFileFormat();
+	_keys = (const DataType*)(_file.data() + sizeof(BinarySearchTreeFileHeader));
+	_size = (int)header->count;									//_checkHeader() bounds count by INT_MAX
+}
+
+//Destructor
+template <class DataType>
+MappedBinarySearchTree<DataType>::~MappedBinarySearchTree() { }
+
+//binary search for the first key not less than q
+template <class DataType>
+int MappedBinarySearchTree<DataType>::_lowerBound(const DataType& q) const
+{
+	int low = 0;
+	int high = _size;
+	while (low < high)
+	{
+		int mid = low + (high - low) / 2;
+		if (_keys[mid] < q)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+//checks to see whether or not the file is empty
+template <class DataType>
+bool MappedBinarySearchTree<DataType>::isEmpty() const
+{
+	return (_size == 0);
+}
+
+//returns the number of keys in the file
+template <class DataType>
+int MappedBinarySearchTree<DataType>::Size() const
+{
+	return _size;
+}
+
+//returns true if a key equal to q is in the file
+template <class DataType>
+bool MappedBinarySearchTree<DataType>::contains(const DataType& q) const
+{
+	int i = _lowerBound(q);
+	return ((i < _size) && !(q < _keys[i]));
+}
+
+//returns the key that matches q, exception otherwise
+template <class DataType>
+DataType MappedBinarySearchTree<DataType>::find(const DataType& q) const
+{
+	int i = _lowerBound(q);
+	if ((i == _size) || (q < _keys[i])) throw BinarySearchTreeNotFound();
+	return _keys[i];
+}
+
+//returns a pointer into the mapping to the smallest key not less than q, NULL if none
+template <class DataType>
+const DataType* MappedBinarySearchTree<DataType>::lowerBound(const DataType& q) const
+{
+	int i = _lowerBound(q);
+	if (i == _size) return NULL;
+	return &_keys[i];
+}
+
+
+#endif	//_BINARYSEARCHTREEFILE_H
@@ -0,0 +1,363 @@
+/*	BitAdjacencyGraph.h
+*	BitAdjacencyGraph implements an unweighted, non-directional graph as an adjacency matrix of
+*	bits.  Each row is an array of 64-bit words, padded to a multiple of four words so that row
+*	operations can be done 256 bits at a time.  hasEdge() is a single bit test, neighbors are
+*	found by counting trailing zeros, and the degree of a vertex is the popcount of its row.
+*	This takes 1/64th of the memory of AdjacencyMatrixGraph's double matrix, so a dense graph
+*	of 100,000 vertices fits in about 1.25 GB.
+*
+*	Edge data is kept in a SparseEdgeData hash table that only holds entries for edges that
+*	have been given data, rather than in a second n x n matrix.  Each edge has one entry, under
+*	(smaller end, larger end).  edgeInfo() gives an edge without data a default entry so that
+*	writes through its reference are kept; readEdgeInfo() stores nothing.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _BITADJACENCYGRAPH_H
+#define _BITADJACENCYGRAPH_H
+
+#include "AbstractGraph.h"
+#include "BitOperations.h"
+#include "SparseEdgeData.h"
+#include <cstdint>
+
+using namespace std;
+
+const int BIT_GRAPH_ROW_ALIGN = 4;								//row length is a multiple of this many words
+
+
+template <class VertexObject, class EdgeObject>
+class BitAdjacencyGraph :
+	virtual public AbstractUnweightedGraph<VertexObject, EdgeObject>
+{
+protected:
+	vector<VertexObject> _vertexData;							//data stored in each vertex
+	vector<uint64_t> _bits;										//row v starts at _bits[v * _rowWords]
+	SparseEdgeData<EdgeObject> _edgeData;						//data of the edges that have it
+	int _vertexCount;
+	int _rowWords;												//64-bit words per row, padded
+	int _edgeCount;
+
+	void _orient(int& start, int& end);							//puts an edge in its data key order
+	void _checkEdge(int start, int end);						//throws if either end is not a vertex
+	void _setBit(int start, int end);
+	void _clearBit(int start, int end);
+
+public:
+	//See AbstractGraph.h for descriptions of methods
+	BitAdjacencyGraph();
+	BitAdjacencyGraph(const int n);
+	virtual ~BitAdjacencyGraph();
+	int edgeCount();
+	int vertexCount();
+	void setVertexInfo(int v, VertexObject& info);
+	void setEdgeInfo(int start, int end, EdgeObject& info);
+	VertexObject& vertexInfo(int v);
+	bool hasEdge(int start, int end);
+	EdgeObject& edgeInfo(int start, int end);
+	const EdgeObject& readEdgeInfo(int start, int end);
+	double edgeWeight(int start, int end);
+	vector<int> neighbors(int v);
+	void displayNeighbors(int v, ostream& os);
+	void deleteEdge(int start, int end);
+	void addEdge(int start, int end);
+	void addEdge(int start, int end, EdgeObject& info);
+	int loadEdges(const vector<GraphEdge>& edgeList);			//adds a list of edges, skipping duplicates
+
+	int degree(int v);											//popcount of v's row
+	template <class Visitor>
+	void forEachNeighbor(int v, Visitor& visit);				//calls visit(w) for each neighbor w, in order
+	const uint64_t* row(int v);									//returns the bit row of v
+	int rowWords();												//returns the number of words in a row
+	int commonNeighborCount(int u, int v);						//popcount of the AND of two rows
+	void orRow(int v, uint64_t* dest);							//dest |= row of v, dest has rowWords() words
+};
+
+
+//default constructor, empty graph
+template <class VertexObject, class EdgeObject>
+BitAdjacencyGraph<VertexObject, EdgeObject>::BitAdjacencyGraph()
+{
+	_vertexCount = 0;
+	_rowWords = 0;
+	_edgeCount = 0;
+}
+
+//constructor to create graph with n vertices and no edges
+template <class VertexObject, class EdgeObject>
+BitAdjacencyGraph<VertexObject, EdgeObject>::BitAdjacencyGraph(const int n)
+{
+	if (n < 0) throw GraphNegativeCount();
+	_vertexCount = n;
+	_edgeCount = 0;
+	int words = (n + 63) / 64;
+	_rowWords = ((words + BIT_GRAPH_ROW_ALIGN - 1) / BIT_GRAPH_ROW_ALIGN) * BIT_GRAPH_ROW_ALIGN;
+	_vertexData.resize(n);
+	_bits.assign((size_t)n * _rowWords, 0);
+}
+
+//destructor
+template <class VertexObject, class EdgeObject>
+BitAdjacencyGraph<VertexObject, EdgeObject>::~BitAdjacencyGraph() { }
+
+
+//an edge keeps its data under (smaller end, larger end)
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::_orient(int& start, int& end)
+{
+	if (start > end)
+	{
+		int t = start;
+		start = end;
+		end = t;
+	}
+}
+
+//throws if either end of an edge is out of range
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::_checkEdge(int start, int end)
+{
+	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount()))
+		throw GraphEdgeOutOfBounds();
+}
+
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::_setBit(int start, int end)
+{
+	_bits[(size_t)start * _rowWords + (end >> 6)] |= (uint64_t)1 << (end & 63);
+}
+
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::_clearBit(int start, int end)
+{
+	_bits[(size_t)start * _rowWords + (end >> 6)] &= ~((uint64_t)1 << (end & 63));
+}
+
+
+//return the number of vertices in the graph
+template <class VertexObject, class EdgeObject>
+int BitAdjacencyGraph<VertexObject, EdgeObject>::vertexCount()
+{
+	return _vertexCount;
+}
+
+//returns the number of edges in the graph
+template <class VertexObject, class EdgeObject>
+int BitAdjacencyGraph<VertexObject, EdgeObject>::edgeCount()
+{
+	return _edgeCount;
+}
+
+//return data associated with a vertex
+template <class VertexObject, class EdgeObject>
+VertexObject& BitAdjacencyGraph<VertexObject, EdgeObject>::vertexInfo(int v)
+{
+	if ((v < 0) || (v >= vertexCount()))
+		throw GraphVertexOutOfBounds();
+	return _vertexData[v];
+}
+
+//set the information of a vertex in a graph
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::setVertexInfo(int v, VertexObject& info)
+{
+	if ((v < 0) || (v >= vertexCount())) return;
+	_vertexData[v] = info;
+}
+
+//return true if edge exists, false otherwise
+template <class VertexObject, class EdgeObject>
+bool BitAdjacencyGraph<VertexObject, EdgeObject>::hasEdge(int start, int end)
+{
+	_checkEdge(start, end);
+	return ((_bits[(size_t)start * _rowWords + (end >> 6)] >> (end & 63)) & 1) != 0;
+}
+
+//return info associated with an edge.  An edge that was never given info is stored with a
+//default first, so writes through the reference stay; use readEdgeInfo() to store nothing.
+template <class VertexObject, class EdgeObject>
+EdgeObject& BitAdjacencyGraph<VertexObject, EdgeObject>::edgeInfo(int start, int end)
+{
+	if (!hasEdge(start, end)) throw GraphEdgeOutOfBounds();
+	_orient(start, end);
+	return _edgeData.get(start, end);
+}
+
+//return info associated with an edge without changing the graph; an edge that was never
+//given info returns a default
+template <class VertexObject, class EdgeObject>
+const EdgeObject& BitAdjacencyGraph<VertexObject, EdgeObject>::readEdgeInfo(int start, int end)
+{
+	if (!hasEdge(start, end)) throw GraphEdgeOutOfBounds();
+	_orient(start, end);
+	return _edgeData.read(start, end);
+}
+
+//set the information of an existing edge
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::setEdgeInfo(int start, int end, EdgeObject& info)
+{
+	if (!hasEdge(start, end)) throw GraphNonExistentEdge();
+	_orient(start, end);
+	_edgeData.set(start, end, info);
+}
+
+//return weight of an edge:  1 if it exists, 0 otherwise
+template <class VertexObject, class EdgeObject>
+double BitAdjacencyGraph<VertexObject, EdgeObject>::edgeWeight(int start, int end)
+{
+	return hasEdge(start, end) ? 1.0 : 0.0;
+}
+
+//return vector of neighbors of vertex
+template <class VertexObject, class EdgeObject>
+vector<int> BitAdjacencyGraph<VertexObject, EdgeObject>::neighbors(int v)
+{
+	vector<int> result;
+	if ((v < 0) || (v >= vertexCount())) return result;
+	result.reserve(degree(v));
+	const uint64_t* r = row(v);
+	for (int i = 0; i < _rowWords; i++)
+	{
+		uint64_t word = r[i];
+		while (word != 0)
+		{
+			result.push_back(i * 64 + countTrailingZeros(word));
+			word &= word - 1;									//clear the lowest set bit
+		}
+	}
+	return result;
+}
+
+//calls visit(w) for every neighbor w of v in ascending order, without allocating
+template <class VertexObject, class EdgeObject>
+template <class Visitor>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::forEachNeighbor(int v, Visitor& visit)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+	const uint64_t* r = row(v);
+	for (int i = 0; i < _rowWords; i++)
+	{
+		uint64_t word = r[i];
+		while (word != 0)
+		{
+			visit(i * 64 + countTrailingZeros(word));
+			word &= word - 1;
+		}
+	}
+}
+
+//displayNeighbors():  displays the neighbors of a vertex into an ostream
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::displayNeighbors(int v, ostream& os)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+	vector<int> neighborList = neighbors(v);
+	this->printVector(neighborList, os);
+}
+
+//returns the degree of v as the popcount of its row
+template <class VertexObject, class EdgeObject>
+int BitAdjacencyGraph<VertexObject, EdgeObject>::degree(int v)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+	const uint64_t* r = row(v);
+	int count = 0;
+	for (int i = 0; i < _rowWords; i++)
+		count += popCount(r[i]);
+	return count;
+}
+
+//returns the first word of v's row
+template <class VertexObject, class EdgeObject>
+const uint64_t* BitAdjacencyGraph<VertexObject, EdgeObject>::row(int v)
+{
+	return _bits.data() + (size_t)v * _rowWords;
+}
+
+//returns the number of words in each row
+template <class VertexObject, class EdgeObject>
+int BitAdjacencyGraph<VertexObject, EdgeObject>::rowWords()
+{
+	return _rowWords;
+}
+
+//returns the number of vertices adjacent to both u and v
+template <class VertexObject, class EdgeObject>
+int BitAdjacencyGraph<VertexObject, EdgeObject>::commonNeighborCount(int u, int v)
+{
+	if ((u < 0) || (u >= vertexCount()) || (v < 0) || (v >= vertexCount()))
+		throw GraphVertexOutOfBounds();
+	const uint64_t* a = row(u);
+	const uint64_t* b = row(v);
+	int count = 0;
+	for (int i = 0; i < _rowWords; i++)
+		count += popCount(a[i] & b[i]);
+	return count;
+}
+
+//ORs the row of v into dest, which must hold rowWords() words
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::orRow(int v, uint64_t* dest)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+	const uint64_t* r = row(v);
+	for (int i = 0; i < _rowWords; i++)
+		dest[i] |= r[i];
+}
+
+//delete an edge in the graph
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::deleteEdge(int start, int end)
+{
+	if (!hasEdge(start, end)) throw GraphEdgeOutOfBounds();
+	_clearBit(start, end);
+	_clearBit(end, start);
+	_orient(start, end);
+	_edgeData.erase(start, end);
+	_edgeCount--;
+}
+
+//add an edge in the graph that doesn't contain any info
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::addEdge(int start, int end)
+{
+	if (hasEdge(start, end)) throw GraphDuplicateEdge();
+	_setBit(start, end);
+	_setBit(end, start);
+	_edgeCount++;
+}
+
+//add an edge in the graph that contains info
+template <class VertexObject, class EdgeObject>
+void BitAdjacencyGraph<VertexObject, EdgeObject>::addEdge(int start, int end, EdgeObject& info)
+{
+	addEdge(start, end);
+	_orient(start, end);
+	_edgeData.set(start, end, info);
+}
+
+//loadEdges():  adds every edge of a list in one pass and returns the number added.  All ends
+//are checked first; edges already present or repeated in the list are skipped.
+template <class VertexObject, class EdgeObject>
+int BitAdjacencyGraph<VertexObject, EdgeObject>::loadEdges(const vector<GraphEdge>& edgeList)
+{
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+		_checkEdge(edgeList[i].start, edgeList[i].end);
+	int added = 0;
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		int start = edgeList[i].start;
+		int end = edgeList[i].end;
+		if ((_bits[(size_t)start * _rowWords + (end >> 6)] >> (end & 63)) & 1) continue;
+		_setBit(start, end);
+		_setBit(end, start);
+		added++;
+	}
+	_edgeCount += added;
+	return added;
+}
+
+
+#endif	//_BITADJACENCYGRAPH_H
@@ -0,0 +1,94 @@
+/*	BitOperations.h
+*	Portable wrappers for the bit manipulation and prefetch instructions used by the
+*	cache-conscious search and graph classes.  Visual C++ and GCC/Clang expose these under
+*	different names, so every use goes through the functions here.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _BITOPERATIONS_H
+#define _BITOPERATIONS_H
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <xmmintrin.h>
+#endif
+
+
+//countTrailingZeros():  number of zero bits below the lowest set bit, 64 if word is 0
+inline int countTrailingZeros(uint64_t word)
+{
+	if (word == 0) return 64;
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, word);
+	return (int)index;
+#elif defined(__GNUC__)
+	return __builtin_ctzll(word);
+#else
+	int count = 0;
+	while ((word & 1) == 0)
+	{
+		word >>= 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+//countLeadingZeros():  number of zero bits above the highest set bit, 64 if word is 0
+inline int countLeadingZeros(uint64_t word)
+{
+	if (word == 0) return 64;
+#if defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanReverse64(&index, word);
+	return 63 - (int)index;
+#elif defined(__GNUC__)
+	return __builtin_clzll(word);
+#else
+	int count = 0;
+	while ((word & ((uint64_t)1 << 63)) == 0)
+	{
+		word <<= 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+//popCount():  number of set bits in word
+inline int popCount(uint64_t word)
+{
+#if defined(_MSC_VER) && defined(_M_X64)
+	return (int)__popcnt64(word);
+#elif defined(__GNUC__)
+	return __builtin_popcountll(word);
+#else
+	int count = 0;
+	while (word != 0)
+	{
+		word &= word - 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+//prefetchRead():  hints that the cache line holding p will be read soon.  p does not have to
+//be a valid address; prefetches never fault.
+inline void prefetchRead(const void* p)
+{
+#if defined(_MSC_VER)
+	_mm_prefetch((const char*)p, _MM_HINT_T0);
+#elif defined(__GNUC__)
+	__builtin_prefetch(p, 0, 3);
+#else
+	(void)p;
+#endif
+}
+
+
+#endif	//_BITOPERATIONS_H
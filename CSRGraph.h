@@ -0,0 +1,461 @@
+/*	CSRGraph.h
+*	CSRGraph stores a graph in compressed sparse row form:  the neighbors of every vertex are
+*	kept sorted in one contiguous array, with an offsets array marking where each vertex's row
+*	begins, and the weight and edge data of each stored edge in arrays parallel to it.  Memory
+*	is O(V + E) instead of the O(V^2) of AdjacencyMatrixGraph, and scanning the neighbors of a
+*	vertex is a walk over contiguous memory.
+*
+*	The graph is built from an edge list in O(V + E) with two counting-sort passes.  An
+*	undirected graph stores each edge in both rows.  addEdge() and deleteEdge() are supported
+*	but shift the arrays, so they cost O(E); build graphs in bulk wherever possible.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _CSRGRAPH_H
+#define _CSRGRAPH_H
+
+#include "AbstractGraph.h"
+#include <algorithm>
+#include <climits>
+
+using namespace std;
+
+template <class VertexObject, class EdgeObject> class GraphFile;
+
+
+template <class VertexObject, class EdgeObject>
+class CSRGraph :
+	virtual public AbstractWeightedGraph<VertexObject, EdgeObject>
+{
+protected:
+	vector<VertexObject> _vertexData;							//data stored in each vertex
+	vector<int> _offsets;										//row v is _targets[_offsets[v] .. _offsets[v+1])
+	vector<int> _targets;										//neighbor ids, sorted within each row
+	vector<double> _weights;									//weight of each stored edge
+	vector<EdgeObject> _edgeData;								//data of each stored edge
+	bool _directed;												//false if each edge is stored in both rows
+	int _edgeCount;												//number of edges (not stored entries)
+
+	void _build(int n, const vector<GraphEdge>& edgeList);		//counting-sort build from an edge list
+	void _countEdges();											//recomputes _edgeCount from the rows
+	int _edgeIndex(int start, int end);							//position of (start, end), -1 if absent
+	void _checkVertex(int v);									//throws if v is not a vertex
+	void _insertEntry(int start, int end, double weight, const EdgeObject& info);	//O(E) insert of one entry
+	void _eraseEntry(int start, int end);						//O(E) removal of one entry
+
+public:
+	//See AbstractGraph.h for descriptions of methods
+	CSRGraph();
+	CSRGraph(int n, const vector<GraphEdge>& edgeList, bool directed = false);
+	CSRGraph(AbstractGraph<VertexObject, EdgeObject>& g);		//snapshot of any graph
+	virtual ~CSRGraph();
+	int edgeCount();
+	int vertexCount();
+	bool directed();
+	void setVertexInfo(int v, VertexObject& info);
+	void setEdgeInfo(int start, int end, EdgeObject& info);
+	VertexObject& vertexInfo(int v);
+	bool hasEdge(int start, int end);
+	EdgeObject& edgeInfo(int start, int end);
+	double edgeWeight(int start, int end);
+	vector<int> neighbors(int v);
+	void displayNeighbors(int v, ostream& os);
+	void deleteEdge(int start, int end);
+	void addEdge(int start, int end);
+	void addEdge(int start, int end, double weight);
+	void addEdge(int start, int end, double weight, EdgeObject& info);
+
+	int degree(int v);											//returns the number of neighbors of v
+	const int* neighborBegin(int v);							//first neighbor of v in the contiguous row
+	const int* neighborEnd(int v);								//one past the last neighbor of v
+	const double* weightBegin(int v);							//weight of the edge to *neighborBegin(v)
+	template <class Visitor>
+	void forEachNeighbor(int v, Visitor& visit);				//calls visit(w) for each neighbor w, in order
+	friend class GraphFile<VertexObject, EdgeObject>;
+};
+
+
+//default constructor, empty graph
+template <class VertexObject, class EdgeObject>
+CSRGraph<VertexObject, EdgeObject>::CSRGraph()
+{
+	_directed = false;
+	_offsets.resize(1, 0);
+	_edgeCount = 0;
+}
+
+//constructor that builds a graph of n vertices from an edge list.  Duplicate edges are
+//merged, keeping the first occurrence.
+template <class VertexObject, class EdgeObject>
+CSRGraph<VertexObject, EdgeObject>::CSRGraph(int n, const vector<GraphEdge>& edgeList, bool directed)
+{
+	_directed = directed;
+	_build(n, edgeList);
+}
+
+//constructor that takes a snapshot of any graph, directed if g is.  Every stored neighbor
+//becomes an entry, so an undirected source gives both directions of each edge as it already
+//has them.
+template <class VertexObject, class EdgeObject>
+CSRGraph<VertexObject, EdgeObject>::CSRGraph(AbstractGraph<VertexObject, EdgeObject>& g)
+{
+	_directed = g.directed();
+	int n = g.vertexCount();
+	_vertexData.resize(n);
+	_offsets.resize(n + 1);
+	_offsets[0] = 0;
+	for (int v = 0; v < n; v++)
+	{
+		_vertexData[v] = g.vertexInfo(v);
+		vector<int> nbors = g.neighbors(v);
+		sort(nbors.begin(), nbors.end());
+		for (unsigned int i = 0; i < nbors.size(); i++)
+		{
+			_targets.push_back(nbors[i]);
+			_weights.push_back(g.edgeWeight(v, nbors[i]));
+			_edgeData.push_back(g.readEdgeInfo(v, nbors[i]));
+		}
+		_offsets[v + 1] = (int)_targets.size();
+	}
+	_countEdges();
+}
+
+//destructor
+template <class VertexObject, class EdgeObject>
+CSRGraph<VertexObject, EdgeObject>::~CSRGraph() { }
+
+
+//_build():  lays out the edge list in O(V + E).  The entries are first bucketed by end vertex,
+//then re-bucketed by start vertex in that order, which leaves every row sorted; duplicates are
+//then adjacent and are squeezed out in the same pass that copies the entries into place.
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::_build(int n, const vector<GraphEdge>& edgeList)
+{
+	if (n < 0) throw GraphNegativeCount();
+	_vertexData.clear();
+	_vertexData.resize(n);
+
+	//expand undirected edges into both directions
+	long long entryCount = 0;
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		const GraphEdge& e = edgeList[i];
+		if ((e.start < 0) || (e.start >= n) || (e.end < 0) || (e.end >= n))
+			throw GraphEdgeOutOfBounds();
+		entryCount += ((_directed) || (e.start == e.end)) ? 1 : 2;
+	}
+	if (entryCount > INT_MAX) throw GraphMemory();
+	int m = (int)entryCount;
+	vector<int> starts(m);
+	vector<int> ends(m);
+	vector<double> weights(m);
+	int k = 0;
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		const GraphEdge& e = edgeList[i];
+		starts[k] = e.start;
+		ends[k] = e.end;
+		weights[k++] = e.weight;
+		if ((!_directed) && (e.start != e.end))
+		{
+			starts[k] = e.end;
+			ends[k] = e.start;
+			weights[k++] = e.weight;
+		}
+	}
+
+	//pass 1:  bucket the entries by end vertex
+	vector<int> count(n + 1, 0);
+	for (int i = 0; i < m; i++)
+		count[ends[i] + 1]++;
+	for (int v = 0; v < n; v++)
+		count[v + 1] += count[v];
+	vector<int> byEnd(m);
+	for (int i = 0; i < m; i++)
+		byEnd[count[ends[i]]++] = i;
+
+	//pass 2:  stable bucket by start vertex, which sorts each row by end vertex
+	vector<int> position(n + 1, 0);
+	for (int i = 0; i < m; i++)
+		position[starts[i] + 1]++;
+	for (int v = 0; v < n; v++)
+		position[v + 1] += position[v];
+	vector<int> order(m);
+	for (int i = 0; i < m; i++)
+	{
+		int entry = byEnd[i];
+		order[position[starts[entry]]++] = entry;
+	}
+
+	//copy into place, dropping repeated (start, end) pairs
+	_offsets.assign(n + 1, 0);
+	_targets.clear();
+	_weights.clear();
+	_targets.reserve(m);
+	_weights.reserve(m);
+	int previousStart = -1;
+	int previousEnd = -1;
+	for (int i = 0; i < m; i++)
+	{
+		int entry = order[i];
+		if ((starts[entry] == previousStart) && (ends[entry] == previousEnd))
+			continue;
+		previousStart = starts[entry];
+		previousEnd = ends[entry];
+		_targets.push_back(ends[entry]);
+		_weights.push_back(weights[entry]);
+		_offsets[starts[entry] + 1]++;
+	}
+	for (int v = 0; v < n; v++)
+		_offsets[v + 1] += _offsets[v];
+	_edgeData.clear();
+	_edgeData.resize(_targets.size());
+	_countEdges();
+}
+
+//recomputes the number of edges:  entries for a directed graph, otherwise each non-loop
+//edge is stored twice and each loop once
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::_countEdges()
+{
+	if (_directed)
+	{
+		_edgeCount = (int)_targets.size();
+		return;
+	}
+	int loops = 0;
+	for (int v = 0; v < vertexCount(); v++)
+		for (int i = _offsets[v]; i < _offsets[v + 1]; i++)
+			if (_targets[i] == v) loops++;
+	_edgeCount = ((int)_targets.size() + loops) / 2;
+}
+
+//throws if v is not a vertex of the graph
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::_checkVertex(int v)
+{
+	if ((v < 0) || (v >= vertexCount())) throw GraphVertexOutOfBounds();
+}
+
+//binary search of start's row for end; returns the entry index or -1
+template <class VertexObject, class EdgeObject>
+int CSRGraph<VertexObject, EdgeObject>::_edgeIndex(int start, int end)
+{
+	if ((start < 0) || (start >= vertexCount()) || (end < 0) || (end >= vertexCount()))
+		throw GraphEdgeOutOfBounds();
+	const int* first = _targets.data() + _offsets[start];
+	const int* last = _targets.data() + _offsets[start + 1];
+	const int* p = lower_bound(first, last, end);
+	if ((p == last) || (*p != end)) return -1;
+	return (int)(p - _targets.data());
+}
+
+//inserts one entry into start's row, keeping the row sorted
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::_insertEntry(int start, int end, double weight, const EdgeObject& info)
+{
+	const int* first = _targets.data() + _offsets[start];
+	const int* last = _targets.data() + _offsets[start + 1];
+	int index = (int)(lower_bound(first, last, end) - _targets.data());
+	_targets.insert(_targets.begin() + index, end);
+	_weights.insert(_weights.begin() + index, weight);
+	_edgeData.insert(_edgeData.begin() + index, info);
+	for (int v = start + 1; v <= vertexCount(); v++)
+		_offsets[v]++;
+}
+
+//removes one entry from start's row, exception if there is none
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::_eraseEntry(int start, int end)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) throw GraphNonExistentEdge();
+	_targets.erase(_targets.begin() + index);
+	_weights.erase(_weights.begin() + index);
+	_edgeData.erase(_edgeData.begin() + index);
+	for (int v = start + 1; v <= vertexCount(); v++)
+		_offsets[v]--;
+}
+
+
+//return the number of vertices in the graph
+template <class VertexObject, class EdgeObject>
+int CSRGraph<VertexObject, EdgeObject>::vertexCount()
+{
+	return (int)_vertexData.size();
+}
+
+//returns the number of edges in the graph
+template <class VertexObject, class EdgeObject>
+int CSRGraph<VertexObject, EdgeObject>::edgeCount()
+{
+	return _edgeCount;
+}
+
+//returns true if each edge is stored only in its start vertex's row
+template <class VertexObject, class EdgeObject>
+bool CSRGraph<VertexObject, EdgeObject>::directed()
+{
+	return _directed;
+}
+
+//return data associated with a vertex
+template <class VertexObject, class EdgeObject>
+VertexObject& CSRGraph<VertexObject, EdgeObject>::vertexInfo(int v)
+{
+	_checkVertex(v);
+	return _vertexData[v];
+}
+
+//set the information of a vertex in a graph
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::setVertexInfo(int v, VertexObject& info)
+{
+	if ((v < 0) || (v >= vertexCount())) return;
+	_vertexData[v] = info;
+}
+
+//return true if edge exists, false otherwise
+template <class VertexObject, class EdgeObject>
+bool CSRGraph<VertexObject, EdgeObject>::hasEdge(int start, int end)
+{
+	return (_edgeIndex(start, end) >= 0);
+}
+
+//return info associated with an edge
+template <class VertexObject, class EdgeObject>
+EdgeObject& CSRGraph<VertexObject, EdgeObject>::edgeInfo(int start, int end)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) throw GraphEdgeOutOfBounds();
+	return _edgeData[index];
+}
+
+//set the information of an existing edge, and of its mirror entry in an undirected graph
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::setEdgeInfo(int start, int end, EdgeObject& info)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) throw GraphNonExistentEdge();
+	_edgeData[index] = info;
+	if ((!_directed) && (start != end))
+	{
+		int mirror = _edgeIndex(end, start);
+		if (mirror < 0) throw GraphNonExistentEdge();
+		_edgeData[mirror] = info;
+	}
+}
+
+//return weight of an edge, 0 if there is no edge
+template <class VertexObject, class EdgeObject>
+double CSRGraph<VertexObject, EdgeObject>::edgeWeight(int start, int end)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) return 0.0;
+	return _weights[index];
+}
+
+//return vector of neighbors of vertex
+template <class VertexObject, class EdgeObject>
+vector<int> CSRGraph<VertexObject, EdgeObject>::neighbors(int v)
+{
+	vector<int> result;
+	if ((v < 0) || (v >= vertexCount())) return result;
+	result.assign(neighborBegin(v), neighborEnd(v));
+	return result;
+}
+
+//displayNeighbors():  displays the neighbors of a vertex into an ostream
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::displayNeighbors(int v, ostream& os)
+{
+	_checkVertex(v);
+	vector<int> neighborList = neighbors(v);
+	this->printVector(neighborList, os);
+}
+
+//returns the number of neighbors of v
+template <class VertexObject, class EdgeObject>
+int CSRGraph<VertexObject, EdgeObject>::degree(int v)
+{
+	_checkVertex(v);
+	return _offsets[v + 1] - _offsets[v];
+}
+
+//returns a pointer to the first neighbor of v; neighbors are in ascending order
+template <class VertexObject, class EdgeObject>
+const int* CSRGraph<VertexObject, EdgeObject>::neighborBegin(int v)
+{
+	_checkVertex(v);
+	return _targets.data() + _offsets[v];
+}
+
+//returns a pointer one past the last neighbor of v
+template <class VertexObject, class EdgeObject>
+const int* CSRGraph<VertexObject, EdgeObject>::neighborEnd(int v)
+{
+	_checkVertex(v);
+	return _targets.data() + _offsets[v + 1];
+}
+
+//returns a pointer to the weights parallel to v's neighbors
+template <class VertexObject, class EdgeObject>
+const double* CSRGraph<VertexObject, EdgeObject>::weightBegin(int v)
+{
+	_checkVertex(v);
+	return _weights.data() + _offsets[v];
+}
+
+//calls visit(w) for every neighbor w of v in ascending order
+template <class VertexObject, class EdgeObject>
+template <class Visitor>
+void CSRGraph<VertexObject, EdgeObject>::forEachNeighbor(int v, Visitor& visit)
+{
+	_checkVertex(v);
+	const int* p = _targets.data() + _offsets[v];
+	const int* last = _targets.data() + _offsets[v + 1];
+	for (; p < last; p++)
+		visit(*p);
+}
+
+//delete an edge in the graph, and its mirror entry in an undirected graph
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::deleteEdge(int start, int end)
+{
+	if (!hasEdge(start, end)) throw GraphEdgeOutOfBounds();
+	_eraseEntry(start, end);
+	if ((!_directed) && (start != end))
+		_eraseEntry(end, start);
+	_edgeCount--;
+}
+
+//add an edge of weight 1 that doesn't contain any info
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::addEdge(int start, int end)
+{
+	EdgeObject info = EdgeObject();
+	addEdge(start, end, 1.0, info);
+}
+
+//add a weighted edge that doesn't contain any info
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::addEdge(int start, int end, double weight)
+{
+	EdgeObject info = EdgeObject();
+	addEdge(start, end, weight, info);
+}
+
+//add a weighted edge that contains info
+template <class VertexObject, class EdgeObject>
+void CSRGraph<VertexObject, EdgeObject>::addEdge(int start, int end, double weight, EdgeObject& info)
+{
+	if (hasEdge(start, end)) throw GraphDuplicateEdge();
+	_insertEntry(start, end, weight, info);
+	if ((!_directed) && (start != end))
+		_insertEntry(end, start, weight, info);
+	_edgeCount++;
+}
+
+
+#endif	//_CSRGRAPH_H
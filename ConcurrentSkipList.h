@@ -0,0 +1,549 @@
+/*	ConcurrentSkipList.h
+*	ConcurrentSkipList is an ordered set that many threads can read and update at the same
+*	time.  It provides the operations of AbstractBinarySearchTree (contains, find, insert,
+*	remove, isEmpty) using a lock-free skip list in the style of Herlihy and Shavit.  Nodes
+*	are removed by first marking their next pointers and then unlinking them, so readers
+*	never block and never see a half-removed node.
+*
+*	A skip list has no root/left/right structure, so it does not derive from
+*	AbstractBinarySearchTree; the method names and exceptions are the same so that it can be
+*	swapped in for BinarySearchTree.
+*
+*	Memory reclamation is deferred:  removed nodes and overwritten data are kept on a retired
+*	list and freed by reclaim() or the destructor.  reclaim() must only be called while no
+*	other thread is using the list.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _CONCURRENTSKIPLIST_H
+#define _CONCURRENTSKIPLIST_H
+
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include "Exception.h"
+#include "Enumeration.h"
+#include "BinarySearchTree.h"
+
+using namespace std;
+
+const int SKIP_LIST_MAX_LEVEL = 32;
+
+template <class DataType> class ConcurrentSkipListEnumerator;
+
+
+//ConcurrentSkipListNode -- a single tower of the skip list.  The low bit of each next
+//pointer is the "logically deleted" mark for that level.
+template <class DataType>
+class ConcurrentSkipListNode
+{
+public:
+	atomic<DataType*> data;										//data stored in the node, NULL for the head
+	int topLevel;												//highest level this node is linked into
+	atomic<uintptr_t>* next;									//marked next pointers, one per level
+
+	ConcurrentSkipListNode(DataType* d, int level);
+	~ConcurrentSkipListNode();
+};
+
+template <class DataType>
+ConcurrentSkipListNode<DataType>::ConcurrentSkipListNode(DataType* d, int level)
+{
+	data.store(d);
+	topLevel = level;
+	next = new atomic<uintptr_t>[level + 1];
+	for (int i = 0; i <= level; i++)
+		next[i].store(0);
+}
+
+template <class DataType>
+ConcurrentSkipListNode<DataType>::~ConcurrentSkipListNode()
+{
+	DataType* d = data.load();
+	if (d != NULL) delete d;
+	delete[] next;
+}
+
+
+template <class DataType>
+class ConcurrentSkipList
+{
+protected:
+	typedef ConcurrentSkipListNode<DataType> Node;
+
+	//retired nodes and data are pushed onto a lock-free stack and freed later
+	struct RetiredItem
+	{
+		Node* node;
+		DataType* data;
+		RetiredItem* next;
+	};
+
+	Node* _head;												//sentinel tower of height SKIP_LIST_MAX_LEVEL
+	atomic<RetiredItem*> _retired;								//nodes and data waiting to be freed
+
+	static Node* _ptr(uintptr_t word);							//strips the mark bit from a next pointer
+	static bool _marked(uintptr_t word);						//true if the mark bit is set
+	static int _randomLevel();									//geometric level, p = 1/2
+	void _retire(Node* node, DataType* data);					//defers freeing of a node or data
+	bool _find(const DataType& data, Node** preds, Node** succs);	//locates data and unlinks marked nodes
+	Node* _findNode(const DataType& data);						//wait-free search, returns first node >= data
+
+public:
+	ConcurrentSkipList();										//empty constructor
+	virtual ~ConcurrentSkipList();								//destructor
+
+	//operations from AbstractBinarySearchTree.h **************************
+	bool contains(const DataType& q);							//returns true if list contains a node with q
+	DataType find(const DataType& q);							//returns a copy of the match or throws exception
+	void insert(const DataType& data);							//inserts data, overwriting an equal element
+	void remove(const DataType& data);							//removes the element matching data or throws
+	bool isEmpty();												//true if there are no elements
+	int Size();													//returns the number of elements
+	void inOrderDisplay();										//displays the elements in sorted order
+
+	void rangeSearch(const DataType& low, const DataType& high);	//outputs all values in low to high inclusive
+	Enumeration<DataType>* rangeEnumerator(const DataType& low, const DataType& high);
+																//returns a weakly consistent range enumerator
+	void reclaim();												//frees retired memory; caller must be the only user
+};
+
+
+//ConcurrentSkipListEnumerator -- walks the bottom level of the list from low to high.  The
+//enumerator is weakly consistent:  it never returns a removed element twice or out of order,
+//and it sees elements inserted ahead of it while it runs.  nextElement() returns a reference
+//to a private copy so the value remains valid while other threads overwrite the node.
+template <class DataType>
+class ConcurrentSkipListEnumerator : public Enumeration<DataType>
+{
+protected:
+	ConcurrentSkipListNode<DataType>* _curr;
+	DataType _high;
+	DataType _current;
+	void _skipMarked();
+
+public:
+	ConcurrentSkipListEnumerator(ConcurrentSkipListNode<DataType>* start, const DataType& high);
+	bool hasMoreElements();
+	DataType& nextElement();
+};
+
+
+//returns the node portion of a marked next pointer
+template <class DataType>
+ConcurrentSkipListNode<DataType>* ConcurrentSkipList<DataType>::_ptr(uintptr_t word)
+{
+	return (Node*)(word & ~(uintptr_t)1);
+}
+
+//returns true if a next pointer carries the deletion mark
+template <class DataType>
+bool ConcurrentSkipList<DataType>::_marked(uintptr_t word)
+{
+	return ((word & 1) != 0);
+}
+
+//random level with probability 1/2 per level, using a per-thread xorshift generator
+template <class DataType>
+int ConcurrentSkipList<DataType>::_randomLevel()
+{
+	static thread_local uint64_t state = 0;
+	if (state == 0)
+		state = (uint64_t)(uintptr_t)&state ^ 0x9E3779B97F4A7C15ULL;
+	state ^= state << 13;
+	state ^= state >> 7;
+	state ^= state << 17;
+	int level = 0;
+	uint64_t bits = state;
+	while ((bits & 1) && (level < SKIP_LIST_MAX_LEVEL - 1))
+	{
+		level++;
+		bits >>= 1;
+	}
+	return level;
+}
+
+
+//Empty constructor
+template <class DataType>
+ConcurrentSkipList<DataType>::ConcurrentSkipList()
+{
+	_head = new Node(NULL, SKIP_LIST_MAX_LEVEL - 1);
+	if (_head == NULL) throw BinaryTreeMemory();
+	_retired.store(NULL);
+}
+
+
+//Destructor -- frees every node still linked at the bottom level and everything retired
+template <class DataType>
+ConcurrentSkipList<DataType>::~ConcurrentSkipList()
+{
+	Node* curr = _ptr(_head->next[0].load());
+	while (curr != NULL)
+	{
+		Node* succ = _ptr(curr->next[0].load());
+		delete curr;
+		curr = succ;
+	}
+	delete _head;
+	_head = NULL;
+
+	RetiredItem* item = _retired.load();
+	while (item != NULL)
+	{
+		RetiredItem* nextItem = item->next;
+		if (item->node != NULL) delete item->node;
+		if (item->data != NULL) delete item->data;
+		delete item;
+		item = nextItem;
+	}
+	_retired.store(NULL);
+}
+
+
+//pushes a node or an overwritten data object onto the retired stack
+template <class DataType>
+void ConcurrentSkipList<DataType>::_retire(Node* node, DataType* data)
+{
+	RetiredItem* item = new RetiredItem;
+	item->node = node;
+	item->data = data;
+	item->next = _retired.load();
+	while (!_retired.compare_exchange_weak(item->next, item)) { }
+}
+
+
+//_find():  fills preds and succs with the nodes before and at-or-after data on every level,
+//physically unlinking any marked nodes met on the way.  Returns true if data is present.
+template <class DataType>
+bool ConcurrentSkipList<DataType>::_find(const DataType& data, Node** preds, Node** succs)
+{
+retry:
+	Node* pred = _head;
+	Node* curr = NULL;
+	for (int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--)
+	{
+		curr = _ptr(pred->next[level].load());
+		while (curr != NULL)
+		{
+			uintptr_t succ = curr->next[level].load();
+			while (_marked(succ))							//curr is deleted, try to unlink it
+			{
+				uintptr_t expected = (uintptr_t)curr;
+				if (!pred->next[level].compare_exchange_strong(expected, (uintptr_t)_ptr(succ)))
+					goto retry;
+				if (level == 0)								//only one thread unlinks at level 0
+					_retire(curr, NULL);
+				curr = _ptr(succ);
+				if (curr == NULL) break;
+				succ = curr->next[level].load();
+			}
+			if (curr == NULL) break;
+			if (*(curr->data.load()) < data)				//move right while curr < data
+			{
+				pred = curr;
+				curr = _ptr(succ);
+			}
+			else
+				break;
+		}
+		preds[level] = pred;
+		succs[level] = curr;
+	}
+	return ((curr != NULL) && !(data < *(curr->data.load())));
+}
+
+
+//_findNode():  wait-free search that skips marked nodes without unlinking them.  Returns the
+//first live node whose data is not less than data, or NULL.
+template <class DataType>
+ConcurrentSkipListNode<DataType>* ConcurrentSkipList<DataType>::_findNode(const DataType& data)
+{
+	Node* pred = _head;
+	Node* curr = NULL;
+	for (int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--)
+	{
+		curr = _ptr(pred->next[level].load());
+		while (curr != NULL)
+		{
+			uintptr_t succ = curr->next[level].load();
+			while (_marked(succ))
+			{
+				curr = _ptr(succ);
+				if (curr == NULL) break;
+				succ = curr->next[level].load();
+			}
+			if (curr == NULL) break;
+			if (*(curr->data.load()) < data)
+			{
+				pred = curr;
+				curr = _ptr(succ);
+			}
+			else
+				break;
+		}
+	}
+	return curr;
+}
+
+
+//returns true if data is found in the list, false otherwise
+template <class DataType>
+bool ConcurrentSkipList<DataType>::contains(const DataType& q)
+{
+	Node* node = _findNode(q);
+	return ((node != NULL) && !(q < *(node->data.load())));
+}
+
+
+//returns a copy of the element matching q, exception otherwise
+template <class DataType>
+DataType ConcurrentSkipList<DataType>::find(const DataType& q)
+{
+	Node* node = _findNode(q);
+	if (node == NULL) throw BinarySearchTreeNotFound();
+	DataType* d = node->data.load();
+	if (q < *d) throw BinarySearchTreeNotFound();
+	return *d;
+}
+
+
+//inserts data into the list.  As in BinarySearchTree, an equal element is overwritten; if
+//that element is removed while it is being overwritten, data is inserted again as a new node.
+template <class DataType>
+void ConcurrentSkipList<DataType>::insert(const DataType& data)
+{
+	Node* preds[SKIP_LIST_MAX_LEVEL];
+	Node* succs[SKIP_LIST_MAX_LEVEL];
+	DataType* newData = new DataType(data);
+	if (newData == NULL) throw BinaryTreeMemory();
+	int topLevel = _randomLevel();
+
+	while (true)
+	{
+		if (_find(data, preds, succs))					//overwrite the existing element
+		{
+			Node* found = succs[0];
+			DataType* oldData = found->data.exchange(newData);
+			_retire(NULL, oldData);
+			if (!_marked(found->next[0].load())) return;
+
+			//a remove marked the node around the exchange, so the new value may have gone with
+			//it; newData now belongs to that node, and a fresh copy is inserted instead
+			newData = new DataType(data);
+			if (newData == NULL) throw BinaryTreeMemory();
+			continue;
+		}
+
+		Node* node = new Node(newData, topLevel);
+		if (node == NULL) throw BinaryTreeMemory();
+		for (int level = 0; level <= topLevel; level++)
+			node->next[level].store((uintptr_t)succs[level]);
+
+		//linking at level 0 is the point where the element becomes visible
+		uintptr_t expected = (uintptr_t)succs[0];
+		if (!preds[0]->next[0].compare_exchange_strong(expected, (uintptr_t)node))
+		{
+			node->data.store(NULL);						//keep newData for the next attempt
+			delete node;
+			continue;
+		}
+
+		//link the upper levels, refreshing preds and succs whenever a CAS fails
+		for (int level = 1; level <= topLevel; level++)
+		{
+			while (true)
+			{
+				expected = (uintptr_t)succs[level];
+				if (preds[level]->next[level].compare_exchange_strong(expected, (uintptr_t)node))
+					break;
+				_find(data, preds, succs);
+				uintptr_t nodeNext = node->next[level].load();
+				if (_marked(nodeNext))					//node is being removed, stop linking it
+					return;
+				node->next[level].compare_exchange_strong(nodeNext, (uintptr_t)succs[level]);
+			}
+		}
+		return;
+	}
+}
+
+
+//removes the element matching data, exception if it is not present
+template <class DataType>
+void ConcurrentSkipList<DataType>::remove(const DataType& data)
+{
+	Node* preds[SKIP_LIST_MAX_LEVEL];
+	Node* succs[SKIP_LIST_MAX_LEVEL];
+	if (!_find(data, preds, succs)) throw BinarySearchTreeNotFound();
+
+	//mark the upper levels from the top down
+	Node* node = succs[0];
+	for (int level = node->topLevel; level >= 1; level--)
+	{
+		uintptr_t succ = node->next[level].load();
+		while (!_marked(succ))
+		{
+			node->next[level].compare_exchange_strong(succ, succ | 1);
+			succ = node->next[level].load();
+		}
+	}
+
+	//marking level 0 is the point of removal; only one thread can win it
+	uintptr_t succ = node->next[0].load();
+	while (true)
+	{
+		uintptr_t expected = succ & ~(uintptr_t)1;
+		if (node->next[0].compare_exchange_strong(expected, expected | 1))
+		{
+			_find(data, preds, succs);					//unlinks the node on every level
+			return;
+		}
+		succ = node->next[0].load();
+		if (_marked(succ)) throw BinarySearchTreeNotFound();	//another thread removed it first
+	}
+}
+
+
+//checks to see whether or not the list is empty
+template <class DataType>
+bool ConcurrentSkipList<DataType>::isEmpty()
+{
+	uintptr_t word = _head->next[0].load();
+	Node* curr = _ptr(word);
+	while (curr != NULL)
+	{
+		word = curr->next[0].load();
+		if (!_marked(word)) return false;
+		curr = _ptr(word);
+	}
+	return true;
+}
+
+
+//returns the number of live elements; the count is only exact while the list is quiet
+template <class DataType>
+int ConcurrentSkipList<DataType>::Size()
+{
+	int count = 0;
+	Node* curr = _ptr(_head->next[0].load());
+	while (curr != NULL)
+	{
+		uintptr_t word = curr->next[0].load();
+		if (!_marked(word)) count++;
+		curr = _ptr(word);
+	}
+	return count;
+}
+
+
+//displays the elements of the list in sorted order
+template <class DataType>
+void ConcurrentSkipList<DataType>::inOrderDisplay()
+{
+	Node* curr = _ptr(_head->next[0].load());
+	while (curr != NULL)
+	{
+		uintptr_t word = curr->next[0].load();
+		if (!_marked(word)) cout << *(curr->data.load()) << " ";
+		curr = _ptr(word);
+	}
+}
+
+
+//outputs all elements from low to high inclusive
+template <class DataType>
+void ConcurrentSkipList<DataType>::rangeSearch(const DataType& low, const DataType& high)
+{
+	Enumeration<DataType>* e = rangeEnumerator(low, high);
+	while (e->hasMoreElements())
+		cout << e->nextElement() << " ";
+	delete e;
+}
+
+
+//creates an enumerator over the elements from low to high inclusive
+template <class DataType>
+Enumeration<DataType>* ConcurrentSkipList<DataType>::rangeEnumerator(const DataType& low, const DataType& high)
+{
+	return new ConcurrentSkipListEnumerator<DataType>(_findNode(low), high);
+}
+
+
+//reclaim():  unlinks every marked node on every level and frees the retired list.  Must
+//only be called while no other thread is accessing the list.
+template <class DataType>
+void ConcurrentSkipList<DataType>::reclaim()
+{
+	for (int level = SKIP_LIST_MAX_LEVEL - 1; level >= 0; level--)
+	{
+		Node* pred = _head;
+		Node* curr = _ptr(pred->next[level].load());
+		while (curr != NULL)
+		{
+			uintptr_t succ = curr->next[level].load();
+			if (_marked(succ))
+			{
+				pred->next[level].store((uintptr_t)_ptr(succ));
+				if (level == 0) _retire(curr, NULL);
+			}
+			else
+				pred = curr;
+			curr = _ptr(succ);
+		}
+	}
+
+	RetiredItem* item = _retired.exchange(NULL);
+	while (item != NULL)
+	{
+		RetiredItem* nextItem = item->next;
+		if (item->node != NULL) delete item->node;
+		if (item->data != NULL) delete item->data;
+		delete item;
+		item = nextItem;
+	}
+}
+
+
+//constructor for the range enumerator, start is the first node >= low
+template <class DataType>
+ConcurrentSkipListEnumerator<DataType>::ConcurrentSkipListEnumerator(ConcurrentSkipListNode<DataType>* start, const DataType& high)
+	: _high(high)
+{
+	_curr = start;
+	_skipMarked();
+}
+
+//advances _curr past nodes that have been logically deleted
+template <class DataType>
+void ConcurrentSkipListEnumerator<DataType>::_skipMarked()
+{
+	while (_curr != NULL)
+	{
+		uintptr_t word = _curr->next[0].load();
+		if ((word & 1) == 0) return;
+		_curr = (ConcurrentSkipListNode<DataType>*)(word & ~(uintptr_t)1);
+	}
+}
+
+//returns true if there is another element no greater than high
+template <class DataType>
+bool ConcurrentSkipListEnumerator<DataType>::hasMoreElements()
+{
+	return ((_curr != NULL) && !(_high < *(_curr->data.load())));
+}
+
+//returns the next element in the range
+template <class DataType>
+DataType& ConcurrentSkipListEnumerator<DataType>::nextElement()
+{
+	if (!hasMoreElements()) throw BinaryTreeEmptyTree();
+	_current = *(_curr->data.load());
+	_curr = (ConcurrentSkipListNode<DataType>*)(_curr->next[0].load() & ~(uintptr_t)1);
+	_skipMarked();
+	return _current;
+}
+
+
+#endif	//_CONCURRENTSKIPLIST_H
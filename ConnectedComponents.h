@@ -0,0 +1,218 @@
+/*	ConnectedComponents.h
+*	ConnectedComponents finds the connected components of a graph with a union-find forest
+*	that every thread of a ThreadPool updates at once.  Each thread takes chunks of vertices and
+*	unites every vertex with its neighbors.  A root is linked beneath the other root with a
+*	compare-and-swap, always the larger id under the smaller, so concurrent links can never
+*	form a cycle; a failed swap just means another thread linked first, and the union is
+*	retried from the new roots.  Finds halve the path they walk, which keeps the trees flat
+*	without locks.
+*
+*	Every vertex is examined once, so unlike repeated depth-first searches no neighbor vector
+*	is built.  The graph class must provide vertexCount() and forEachNeighbor(v, visit), as
+*	AdjacencyMatrixGraph, CSRGraph and BitAdjacencyGraph do; a bulk edge list can be used
+*	directly.  For a directed graph the components found are the weakly connected ones.
+*
+*	Components are numbered 0, 1, ... in order of their smallest vertex.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _CONNECTEDCOMPONENTS_H
+#define _CONNECTEDCOMPONENTS_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include "AbstractGraph.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+const int COMPONENTS_CHUNK = 256;								//vertices or edges per work chunk
+
+
+class ConnectedComponents
+{
+protected:
+	int _vertexCount;
+	unique_ptr<atomic<int>[]> _forest;							//union-find parent of each vertex
+	vector<int> _labels;										//component number of each vertex
+	vector<int> _sizes;											//number of vertices in each component
+
+	void _start(int n);											//makes every vertex its own root
+	int _find(int v);											//returns the root of v, halving the path
+	void _unite(int a, int b);									//merges the trees of a and b
+	void _finish(ThreadPool& pool);								//numbers the components and counts them
+
+public:
+	template <class GraphType>
+	ConnectedComponents(GraphType& g, ThreadPool& pool);		//components of a graph
+	ConnectedComponents(int n, const vector<GraphEdge>& edgeList, ThreadPool& pool);	//components of an edge list
+	virtual ~ConnectedComponents();
+
+	int vertexCount();											//returns the number of vertices
+	int componentCount();										//returns the number of components
+	int component(int v);										//returns the component number of v
+	int componentSize(int c);									//returns the number of vertices in component c
+	bool connected(int u, int v);								//true if u and v are in the same component
+	const vector<int>& labels();								//component number of every vertex
+	const vector<int>& sizes();									//size of every component
+};
+
+
+//constructor -- unites every vertex of g with its neighbors, in parallel over the vertices
+template <class GraphType>
+ConnectedComponents::ConnectedComponents(GraphType& g, ThreadPool& pool)
+{
+	_start(g.vertexCount());
+	pool.parallelFor(0, _vertexCount, COMPONENTS_CHUNK, [&](int low, int high, int /*thread*/)
+	{
+		for (int v = low; v < high; v++)
+		{
+			auto visit = [&](int w)
+			{
+				_unite(v, w);
+			};
+			g.forEachNeighbor(v, visit);
+		}
+	});
+	_finish(pool);
+}
+
+//constructor -- unites the ends of every edge in the list, in parallel over the edges
+inline ConnectedComponents::ConnectedComponents(int n, const vector<GraphEdge>& edgeList, ThreadPool& pool)
+{
+	if (n < 0) throw GraphNegativeCount();
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		const GraphEdge& e = edgeList[i];
+		if ((e.start < 0) || (e.start >= n) || (e.end < 0) || (e.end >= n))
+			throw GraphEdgeOutOfBounds();
+	}
+	_start(n);
+	pool.parallelFor(0, (int)edgeList.size(), COMPONENTS_CHUNK, [&](int low, int high, int /*thread*/)
+	{
+		for (int i = low; i < high; i++)
+			_unite(edgeList[i].start, edgeList[i].end);
+	});
+	_finish(pool);
+}
+
+//destructor
+inline ConnectedComponents::~ConnectedComponents() { }
+
+
+//_start():  sizes the forest for n vertices, each its own root
+inline void ConnectedComponents::_start(int n)
+{
+	_vertexCount = n;
+	_forest.reset(new atomic<int>[n]);
+	for (int v = 0; v < n; v++)
+		_forest[v].store(v, memory_order_relaxed);
+}
+
+//_find():  follows parents to the root of v.  Each vertex passed is pointed at its
+//grandparent; if another thread changed it first the swap fails, which is harmless.
+inline int ConnectedComponents::_find(int v)
+{
+	while (true)
+	{
+		int parent = _forest[v].load(memory_order_relaxed);
+		if (parent == v) return v;
+		int grandparent = _forest[parent].load(memory_order_relaxed);
+		if (parent != grandparent)
+			_forest[v].compare_exchange_weak(parent, grandparent, memory_order_relaxed);
+		v = grandparent;
+	}
+}
+
+//_unite():  links the larger of the two roots beneath the smaller.  The swap only succeeds
+//if the larger is still a root; otherwise the roots are found again and the link retried.
+inline void ConnectedComponents::_unite(int a, int b)
+{
+	while (true)
+	{
+		a = _find(a);
+		b = _find(b);
+		if (a == b) return;
+		if (a > b)
+		{
+			int t = a;
+			a = b;
+			b = t;
+		}
+		int expected = b;
+		if (_forest[b].compare_exchange_strong(expected, a, memory_order_relaxed)) return;
+	}
+}
+
+//_finish():  points every vertex at its root, which is the smallest vertex of its component,
+//then numbers the components in order of that vertex and counts their sizes
+inline void ConnectedComponents::_finish(ThreadPool& pool)
+{
+	_labels.resize(_vertexCount);
+	pool.parallelFor(0, _vertexCount, COMPONENTS_CHUNK, [&](int low, int high, int /*thread*/)
+	{
+		for (int v = low; v < high; v++)
+			_labels[v] = _find(v);
+	});
+	_sizes.clear();
+	for (int v = 0; v < _vertexCount; v++)
+	{
+		if (_labels[v] == v)
+		{
+			_labels[v] = (int)_sizes.size();					//roots come before the rest of their component
+			_sizes.push_back(0);
+		}
+		else _labels[v] = _labels[_labels[v]];
+		_sizes[_labels[v]]++;
+	}
+	_forest.reset();
+}
+
+//returns the number of vertices
+inline int ConnectedComponents::vertexCount()
+{
+	return _vertexCount;
+}
+
+//returns the number of components
+inline int ConnectedComponents::componentCount()
+{
+	return (int)_sizes.size();
+}
+
+//returns the component number of v
+inline int ConnectedComponents::component(int v)
+{
+	if ((v < 0) || (v >= _vertexCount)) throw GraphVertexOutOfBounds();
+	return _labels[v];
+}
+
+//returns the number of vertices in component c
+inline int ConnectedComponents::componentSize(int c)
+{
+	if ((c < 0) || (c >= componentCount())) throw GraphVertexOutOfBounds();
+	return _sizes[c];
+}
+
+//returns true if there is a path between u and v
+inline bool ConnectedComponents::connected(int u, int v)
+{
+	return component(u) == component(v);
+}
+
+//returns the component number of every vertex
+inline const vector<int>& ConnectedComponents::labels()
+{
+	return _labels;
+}
+
+//returns the size of every component, indexed by component number
+inline const vector<int>& ConnectedComponents::sizes()
+{
+	return _sizes;
+}
+
+
+#endif	//_CONNECTEDCOMPONENTS_H
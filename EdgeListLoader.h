@@ -0,0 +1,233 @@
+/*	EdgeListLoader.h
+*	EdgeListLoader reads a graph's edge list from a file that is mapped into memory, so the
+*	file is never copied through stream buffers.  The file is cut into chunks that the threads
+*	of a ThreadPool parse at the same time, and the pieces are joined in file order, so the
+*	resulting list is the same however many threads were used.
+*
+*	Text files have one edge per line:  the start vertex, the end vertex and an optional weight
+*	(1 if missing), separated by spaces, tabs or commas.  Further columns are ignored, and lines
+*	beginning with '#' or '%' are comments, so SNAP-style files load as they are.  Binary files
+*	are packed records of two 32-bit vertex ids, each followed by a 64-bit weight in the weighted
+*	format, in the machine's byte order.
+*
+*	The list is used to build a graph in one pass, e.g. with the CSRGraph constructor or with
+*	AdjacencyMatrixGraph::loadEdges(), which skip duplicate edges instead of throwing.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _EDGELISTLOADER_H
+#define _EDGELISTLOADER_H
+
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include "AbstractGraph.h"
+#include "MappedFile.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+class EdgeListException : public Exception { };
+class EdgeListFormatError : public EdgeListException { };
+
+enum EdgeListFormat
+{
+	EDGE_LIST_TEXT,												//"start end [weight]" per line
+	EDGE_LIST_BINARY,											//int32 start, int32 end
+	EDGE_LIST_BINARY_WEIGHTED									//int32 start, int32 end, double weight
+};
+
+const size_t EDGE_LIST_CHUNK_BYTES = 1 << 22;					//text bytes per parse chunk
+const int EDGE_LIST_WEIGHT_LENGTH = 64;							//longest weight token accepted
+
+
+class EdgeListLoader
+{
+protected:
+	ThreadPool& _pool;
+	vector<GraphEdge> _edges;
+	int _vertexCount;											//one more than the largest id read
+
+	void _parseText(const char* data, size_t size);
+	void _parseBinary(const char* data, size_t size, bool weighted);
+	static const char* _parseLine(const char* p, const char* end, vector<GraphEdge>& out);
+	static const char* _parseId(const char* p, const char* end, int& id);
+
+public:
+	EdgeListLoader(ThreadPool& pool);							//parses with the threads of pool
+	virtual ~EdgeListLoader();
+
+	void load(const char* filename, EdgeListFormat format = EDGE_LIST_TEXT);	//replaces the current list
+	const vector<GraphEdge>& edges();							//the edges in file order
+	int vertexCount();											//largest vertex id + 1
+};
+
+
+//constructor
+inline EdgeListLoader::EdgeListLoader(ThreadPool& pool)
+	: _pool(pool)
+{
+	_vertexCount = 0;
+}
+
+//destructor
+inline EdgeListLoader::~EdgeListLoader() { }
+
+//returns the edges read by the last load()
+inline const vector<GraphEdge>& EdgeListLoader::edges()
+{
+	return _edges;
+}
+
+//returns one more than the largest vertex id in the list
+inline int EdgeListLoader::vertexCount()
+{
+	return _vertexCount;
+}
+
+
+//load():  maps filename and parses it in parallel.  Throws MappedFileOpenError if the file
+//cannot be opened and EdgeListFormatError if its contents are not an edge list.
+inline void EdgeListLoader::load(const char* filename, EdgeListFormat format)
+{
+	_edges.clear();
+	_vertexCount = 0;
+	MappedFile file(filename);
+	if (format == EDGE_LIST_TEXT) _parseText(file.data(), file.size());
+	else _parseBinary(file.data(), file.size(), format == EDGE_LIST_BINARY_WEIGHTED);
+	file.close();
+
+	int largest = -1;
+	for (size_t i = 0; i < _edges.size(); i++)
+	{
+		if (_edges[i].start > largest) largest = _edges[i].start;
+		if (_edges[i].end > largest) largest = _edges[i].end;
+	}
+	_vertexCount = largest + 1;
+}
+
+//_parseText():  splits the file into chunks of about EDGE_LIST_CHUNK_BYTES.  A chunk owns every
+//line that starts inside it, so a thread skips the partial line at the front of its chunk and
+//finishes the line that runs past its end.  The chunks' lists are then copied into place.
+inline void EdgeListLoader::_parseText(const char* data, size_t size)
+{
+	int chunks = (int)((size + EDGE_LIST_CHUNK_BYTES - 1) / EDGE_LIST_CHUNK_BYTES);
+	vector<vector<GraphEdge>> pieces(chunks);
+	_pool.parallelFor(0, chunks, 1, [&](int low, int high, int /*thread*/)
+	{
+		for (int c = low; c < high; c++)
+		{
+			const char* end = data + size;
+			const char* p = data + (size_t)c * EDGE_LIST_CHUNK_BYTES;
+			const char* last = data + min(size, (size_t)(c + 1) * EDGE_LIST_CHUNK_BYTES);
+			if ((c > 0) && (p[-1] != '\n'))
+			{
+				while ((p < end) && (*p != '\n'))
+					p++;
+				if (p < end) p++;
+			}
+			while (p < last)
+				p = _parseLine(p, end, pieces[c]);
+		}
+	});
+
+	vector<size_t> offsets(chunks + 1, 0);
+	for (int c = 0; c < chunks; c++)
+		offsets[c + 1] = offsets[c] + pieces[c].size();
+	_edges.resize(offsets[chunks]);
+	_pool.parallelFor(0, chunks, 1, [&](int low, int high, int /*thread*/)
+	{
+		for (int c = low; c < high; c++)
+		{
+			if (!pieces[c].empty())
+				memcpy(&_edges[offsets[c]], pieces[c].data(), pieces[c].size() * sizeof(GraphEdge));
+			vector<GraphEdge>().swap(pieces[c]);
+		}
+	});
+}
+
+//_parseId():  reads a non-negative decimal vertex id at p, returning the position after it
+inline const char* EdgeListLoader::_parseId(const char* p, const char* end, int& id)
+{
+	if ((p >= end) || (*p < '0') || (*p > '9')) throw EdgeListFormatError();
+	long long value = 0;
+	while ((p < end) && (*p >= '0') && (*p <= '9'))
+	{
+		value = value * 10 + (*p - '0');
+		if (value > INT32_MAX) throw EdgeListFormatError();
+		p++;
+	}
+	id = (int)value;
+	return p;
+}
+
+//_parseLine():  parses the line starting at p, adding its edge to out unless it is blank or a
+//comment, and returns the start of the next line
+inline const char* EdgeListLoader::_parseLine(const char* p, const char* end, vector<GraphEdge>& out)
+{
+	while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')))
+		p++;
+	if ((p < end) && (*p != '\n') && (*p != '#') && (*p != '%'))
+	{
+		GraphEdge e;
+		p = _parseId(p, end, e.start);
+		while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == ',')))
+			p++;
+		p = _parseId(p, end, e.end);
+		while ((p < end) && ((*p == ' ') || (*p == '\t') || (*p == ',')))
+			p++;
+
+		//the weight is copied out so strtod() never reads past the end of the mapping; a token
+		//too long for the copy is an error rather than a weight cut short
+		e.weight = 1.0;
+		char token[EDGE_LIST_WEIGHT_LENGTH + 1];
+		int length = 0;
+		while ((p < end) && (*p != ' ') && (*p != '\t') && (*p != ',') && (*p != '\r') && (*p != '\n'))
+		{
+			if (length == EDGE_LIST_WEIGHT_LENGTH) throw EdgeListFormatError();
+			token[length++] = *p++;
+		}
+		if (length > 0)
+		{
+			token[length] = '\0';
+			char* parsed;
+			e.weight = strtod(token, &parsed);
+			if (parsed != token + length) throw EdgeListFormatError();
+		}
+		out.push_back(e);
+	}
+	while ((p < end) && (*p != '\n'))
+		p++;
+	return (p < end) ? p + 1 : p;
+}
+
+//_parseBinary():  the file is an array of fixed-size records, so each thread converts a range
+//of records straight into its place in the list
+inline void EdgeListLoader::_parseBinary(const char* data, size_t size, bool weighted)
+{
+	size_t record = weighted ? 2 * sizeof(int32_t) + sizeof(double) : 2 * sizeof(int32_t);
+	if (size % record != 0) throw EdgeListFormatError();
+	size_t count = size / record;
+	if (count > INT32_MAX) throw GraphMemory();
+	_edges.resize(count);
+	_pool.parallelFor(0, (int)count, (int)(EDGE_LIST_CHUNK_BYTES / record), [&](int low, int high, int /*thread*/)
+	{
+		for (int i = low; i < high; i++)
+		{
+			const char* p = data + i * record;
+			int32_t ends[2];
+			memcpy(ends, p, sizeof(ends));
+			if ((ends[0] < 0) || (ends[1] < 0)) throw EdgeListFormatError();
+			_edges[i].start = ends[0];
+			_edges[i].end = ends[1];
+			if (weighted) memcpy(&_edges[i].weight, p + sizeof(ends), sizeof(double));
+			else _edges[i].weight = 1.0;
+		}
+	});
+}
+
+
+#endif	//_EDGELISTLOADER_H
@@ -15,6 +15,8 @@ template <class DataType>
 class Enumeration
 {
 public:
+	virtual ~Enumeration() { }					//enumerators are deleted through this class
+
 	//Boolean method which determines whether there are any more elements
 	//in the data structure being Enumerated
 	
@@ -0,0 +1,426 @@
+/*	GraphFile.h
+*	Binary snapshot files for the graph classes.  A graph is written in compressed sparse row
+*	form:  a fixed 128-byte header followed by five sections, each starting on a 64-byte
+*	boundary -- the row offsets, the neighbor ids, the edge weights, the vertex data and the
+*	edge data.  Any graph can be saved; it is first taken into a CSRGraph snapshot unless it
+*	already is one.
+*
+*	MappedGraph opens a snapshot without reading it:  the file is mapped copy-on-write and the
+*	sections are used where they lie, so opening a multi-gigabyte graph costs only the page
+*	faults of the parts that are touched.  It answers the read side of AbstractWeightedGraph
+*	plus the CSRGraph row accessors.  Vertex and edge info may be changed in memory, but the
+*	changes are never written back, and adding or deleting edges throws GraphReadOnly.
+*
+*	Vertex and edge data must be trivially copyable; the file uses the byte order of the
+*	machine that wrote it.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _GRAPHFILE_H
+#define _GRAPHFILE_H
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <type_traits>
+#include "AbstractGraph.h"
+#include "MappedFile.h"
+#include "CSRGraph.h"
+
+using namespace std;
+
+class GraphFileError : public GraphException { };
+class GraphFileFormat : public GraphFileError { };
+class GraphReadOnly : public GraphException { };
+
+const uint32_t GRAPH_FILE_VERSION = 1;
+const uint32_t GRAPH_FILE_DIRECTED = 1;							//flag:  each edge is stored once
+const int GRAPH_FILE_ALIGN = 64;								//sections start on this boundary
+
+
+//GraphFileHeader -- 128 bytes; section positions are byte offsets from the start of the file
+struct GraphFileHeader
+{
+	char magic[4];												//"GRPH"
+	uint32_t version;											//GRAPH_FILE_VERSION
+	uint32_t flags;												//GRAPH_FILE_DIRECTED or 0
+	uint32_t vertexSize;										//sizeof(VertexObject) of the writer
+	uint32_t edgeSize;											//sizeof(EdgeObject) of the writer
+	uint32_t reserved0;
+	uint64_t vertexCount;
+	uint64_t entryCount;										//stored neighbor entries
+	uint64_t edgeCount;											//edges, counting each undirected edge once
+	uint64_t offsetsAt;											//int32[vertexCount + 1]
+	uint64_t targetsAt;											//int32[entryCount]
+	uint64_t weightsAt;											//double[entryCount]
+	uint64_t vertexDataAt;										//VertexObject[vertexCount]
+	uint64_t edgeDataAt;										//EdgeObject[entryCount]
+	uint64_t reserved[4];
+};
+
+
+template <class VertexObject, class EdgeObject>
+class GraphFile
+{
+protected:
+	static uint64_t _align(uint64_t position);					//rounds up to GRAPH_FILE_ALIGN
+	static void _writeSection(ofstream& out, uint64_t& position, uint64_t at, const void* data, size_t bytes);
+	static bool _fits(uint64_t at, uint64_t bytes, uint64_t size);	//true if an aligned section lies inside the file
+
+public:
+	static void save(CSRGraph<VertexObject, EdgeObject>& g, const char* filename);
+																//writes the arrays of g
+	static void save(AbstractGraph<VertexObject, EdgeObject>& g, const char* filename);
+																//writes a CSR snapshot of any graph
+	static const GraphFileHeader* checkHeader(const MappedFile& file);	//validates a mapped snapshot
+};
+
+
+//MappedGraph -- a saved graph used in place from a copy-on-write mapping
+template <class VertexObject, class EdgeObject>
+class MappedGraph :
+	virtual public AbstractWeightedGraph<VertexObject, EdgeObject>
+{
+protected:
+	MappedFile _file;
+	int _vertexCount;
+	int _edgeCount;
+	bool _directed;
+	const int* _offsets;
+	const int* _targets;
+	const double* _weights;
+	VertexObject* _vertexData;
+	EdgeObject* _edgeData;
+
+	int _edgeIndex(int start, int end);							//position of (start, end), -1 if absent
+	void _checkVertex(int v);
+
+public:
+	//See AbstractGraph.h for descriptions of methods
+	MappedGraph(const char* filename);							//maps a file written by GraphFile::save()
+	virtual ~MappedGraph();										//unmaps the file
+	int edgeCount();
+	int vertexCount();
+	bool directed();
+	void setVertexInfo(int v, VertexObject& info);				//changes the mapping only, not the file
+	void setEdgeInfo(int start, int end, EdgeObject& info);		//changes the mapping only, not the file
+	VertexObject& vertexInfo(int v);
+	bool hasEdge(int start, int end);
+	EdgeObject& edgeInfo(int start, int end);
+	double edgeWeight(int start, int end);
+	vector<int> neighbors(int v);
+	void displayNeighbors(int v, ostream& os);
+	void deleteEdge(int start, int end);						//throws GraphReadOnly
+	void addEdge(int start, int end, double weight);			//throws GraphReadOnly
+	void addEdge(int start, int end, double weight, EdgeObject& info);	//throws GraphReadOnly
+
+	int degree(int v);											//returns the number of neighbors of v
+	const int* neighborBegin(int v);							//first neighbor of v inside the mapping
+	const int* neighborEnd(int v);								//one past the last neighbor of v
+	const double* weightBegin(int v);							//weight of the edge to *neighborBegin(v)
+	template <class Visitor>
+	void forEachNeighbor(int v, Visitor& visit);				//calls visit(w) for each neighbor w, in order
+};
+
+
+//rounds position up to the next section boundary
+template <class VertexObject, class EdgeObject>
+uint64_t GraphFile<VertexObject, EdgeObject>::_align(uint64_t position)
+{
+	return (position + GRAPH_FILE_ALIGN - 1) / GRAPH_FILE_ALIGN * GRAPH_FILE_ALIGN;
+}
+
+//pads the file from position up to at, then writes bytes of data
+template <class VertexObject, class EdgeObject>
+void GraphFile<VertexObject, EdgeObject>::_writeSection(ofstream& out, uint64_t& position, uint64_t at,
+	const void* data, size_t bytes)
+{
+	static const char zeros[GRAPH_FILE_ALIGN] = { 0 };
+	out.write(zeros, (streamsize)(at - position));
+	if (bytes > 0) out.write((const char*)data, bytes);
+	position = at + bytes;
+}
+
+//save():  writes the header and the five sections of a CSRGraph
+template <class VertexObject, class EdgeObject>
+void GraphFile<VertexObject, EdgeObject>::save(CSRGraph<VertexObject, EdgeObject>& g, const char* filename)
+{
+	static_assert(is_trivially_copyable<VertexObject>::value, "GraphFile requires trivially copyable vertex data");
+	static_assert(is_trivially_copyable<EdgeObject>::value, "GraphFile requires trivially copyable edge data");
+	uint64_t n = g._vertexData.size();
+	uint64_t m = g._targets.size();
+
+	GraphFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "GRPH", 4);
+	header.version = GRAPH_FILE_VERSION;
+	header.flags = g._directed ? GRAPH_FILE_DIRECTED : 0;
+	header.vertexSize = (uint32_t)sizeof(VertexObject);
+	header.edgeSize = (uint32_t)sizeof(EdgeObject);
+	header.vertexCount = n;
+	header.entryCount = m;
+	header.edgeCount = (uint64_t)g._edgeCount;
+	header.offsetsAt = _align(sizeof(GraphFileHeader));
+	header.targetsAt = _align(header.offsetsAt + (n + 1) * sizeof(int32_t));
+	header.weightsAt = _align(header.targetsAt + m * sizeof(int32_t));
+	header.vertexDataAt = _align(header.weightsAt + m * sizeof(double));
+	header.edgeDataAt = _align(header.vertexDataAt + n * sizeof(VertexObject));
+
+	ofstream out(filename, ios::out | ios::binary | ios::trunc);
+	if (!out) throw GraphFileError();
+	out.write((const char*)&header, sizeof(header));
+	uint64_t position = sizeof(header);
+	_writeSection(out, position, header.offsetsAt, g._offsets.data(), (n + 1) * sizeof(int32_t));
+	_writeSection(out, position, header.targetsAt, g._targets.data(), m * sizeof(int32_t));
+	_writeSection(out, position, header.weightsAt, g._weights.data(), m * sizeof(double));
+	_writeSection(out, position, header.vertexDataAt, g._vertexData.data(), n * sizeof(VertexObject));
+	_writeSection(out, position, header.edgeDataAt, g._edgeData.data(), m * sizeof(EdgeObject));
+	out.close();
+	if (!out) throw GraphFileError();
+}
+
+//save():  takes a CSR snapshot of g, directed if g says it is, and writes it
+template <class VertexObject, class EdgeObject>
+void GraphFile<VertexObject, EdgeObject>::save(AbstractGraph<VertexObject, EdgeObject>& g, const char* filename)
+{
+	CSRGraph<VertexObject, EdgeObject> snapshot(g);
+	save(snapshot, filename);
+}
+
+//_fits():  true if a section of bytes at offset at starts on a section boundary and ends
+//inside a file of size bytes.  Written as a subtraction so a huge offset cannot wrap around.
+template <class VertexObject, class EdgeObject>
+bool GraphFile<VertexObject, EdgeObject>::_fits(uint64_t at, uint64_t bytes, uint64_t size)
+{
+	return (at % GRAPH_FILE_ALIGN == 0) && (at <= size) && (bytes <= size - at);
+}
+
+//checkHeader():  validates the header of a mapped file and checks that every section is
+//aligned and lies inside the file.  The contents of the sections are trusted, so opening
+//stays O(1).
+template <class VertexObject, class EdgeObject>
+const GraphFileHeader* GraphFile<VertexObject, EdgeObject>::checkHeader(const MappedFile& file)
+{
+	if (file.size() < sizeof(GraphFileHeader)) throw GraphFileFormat();
+	const GraphFileHeader* header = (const GraphFileHeader*)file.data();
+	if ((memcmp(header->magic, "GRPH", 4) != 0) || (header->version != GRAPH_FILE_VERSION)
+		|| (header->vertexSize != sizeof(VertexObject)) || (header->edgeSize != sizeof(EdgeObject)))
+		throw GraphFileFormat();
+	uint64_t n = header->vertexCount;
+	uint64_t m = header->entryCount;
+	if ((n >= INT32_MAX) || (m > INT32_MAX)) throw GraphFileFormat();
+	uint64_t size = file.size();
+	if (!_fits(header->offsetsAt, (n + 1) * sizeof(int32_t), size)
+		|| !_fits(header->targetsAt, m * sizeof(int32_t), size)
+		|| !_fits(header->weightsAt, m * sizeof(double), size)
+		|| !_fits(header->vertexDataAt, n * sizeof(VertexObject), size)
+		|| !_fits(header->edgeDataAt, m * sizeof(EdgeObject), size))
+		throw GraphFileFormat();
+	const int32_t* offsets = (const int32_t*)(file.data() + header->offsetsAt);
+	if ((offsets[0] != 0) || ((uint64_t)offsets[n] != m)) throw GraphFileFormat();
+	return header;
+}
+
+
+//constructor -- maps the file copy-on-write and points into its sections
+template <class VertexObject, class EdgeObject>
+MappedGraph<VertexObject, EdgeObject>::MappedGraph(const char* filename)
+	: _file(filename, true)
+{
+	static_assert(is_trivially_copyable<VertexObject>::value, "MappedGraph requires trivially copyable vertex data");
+	static_assert(is_trivially_copyable<EdgeObject>::value, "MappedGraph requires trivially copyable edge data");
+	const GraphFileHeader* header = GraphFile<VertexObject, EdgeObject>::checkHeader(_file);
+	char* base = _file.data();
+	_vertexCount = (int)header->vertexCount;
+	_edgeCount = (int)header->edgeCount;
+	_directed = (header->flags & GRAPH_FILE_DIRECTED) != 0;
+	_offsets = (const int*)(base + header->offsetsAt);
+	_targets = (const int*)(base + header->targetsAt);
+	_weights = (const double*)(base + header->weightsAt);
+	_vertexData = (VertexObject*)(base + header->vertexDataAt);
+	_edgeData = (EdgeObject*)(base + header->edgeDataAt);
+}
+
+//destructor
+template <class VertexObject, class EdgeObject>
+MappedGraph<VertexObject, EdgeObject>::~MappedGraph() { }
+
+//throws if v is not a vertex of the graph
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::_checkVertex(int v)
+{
+	if ((v < 0) || (v >= _vertexCount)) throw GraphVertexOutOfBounds();
+}
+
+//binary search of start's row for end; returns the entry index or -1
+template <class VertexObject, class EdgeObject>
+int MappedGraph<VertexObject, EdgeObject>::_edgeIndex(int start, int end)
+{
+	if ((start < 0) || (start >= _vertexCount) || (end < 0) || (end >= _vertexCount))
+		throw GraphEdgeOutOfBounds();
+	const int* first = _targets + _offsets[start];
+	const int* last = _targets + _offsets[start + 1];
+	const int* p = lower_bound(first, last, end);
+	if ((p == last) || (*p != end)) return -1;
+	return (int)(p - _targets);
+}
+
+//return the number of vertices in the graph
+template <class VertexObject, class EdgeObject>
+int MappedGraph<VertexObject, EdgeObject>::vertexCount()
+{
+	return _vertexCount;
+}
+
+//returns the number of edges in the graph
+template <class VertexObject, class EdgeObject>
+int MappedGraph<VertexObject, EdgeObject>::edgeCount()
+{
+	return _edgeCount;
+}
+
+//returns true if the saved graph was directed
+template <class VertexObject, class EdgeObject>
+bool MappedGraph<VertexObject, EdgeObject>::directed()
+{
+	return _directed;
+}
+
+//return data associated with a vertex
+template <class VertexObject, class EdgeObject>
+VertexObject& MappedGraph<VertexObject, EdgeObject>::vertexInfo(int v)
+{
+	_checkVertex(v);
+	return _vertexData[v];
+}
+
+//set the information of a vertex; the change is private to this mapping
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::setVertexInfo(int v, VertexObject& info)
+{
+	if ((v < 0) || (v >= _vertexCount)) return;
+	_vertexData[v] = info;
+}
+
+//return true if edge exists, false otherwise
+template <class VertexObject, class EdgeObject>
+bool MappedGraph<VertexObject, EdgeObject>::hasEdge(int start, int end)
+{
+	return (_edgeIndex(start, end) >= 0);
+}
+
+//return info associated with an edge
+template <class VertexObject, class EdgeObject>
+EdgeObject& MappedGraph<VertexObject, EdgeObject>::edgeInfo(int start, int end)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) throw GraphEdgeOutOfBounds();
+	return _edgeData[index];
+}
+
+//set the information of an existing edge; the change is private to this mapping
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::setEdgeInfo(int start, int end, EdgeObject& info)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) throw GraphNonExistentEdge();
+	_edgeData[index] = info;
+}
+
+//return weight of an edge, 0 if there is no edge
+template <class VertexObject, class EdgeObject>
+double MappedGraph<VertexObject, EdgeObject>::edgeWeight(int start, int end)
+{
+	int index = _edgeIndex(start, end);
+	if (index < 0) return 0.0;
+	return _weights[index];
+}
+
+//return vector of neighbors of vertex
+template <class VertexObject, class EdgeObject>
+vector<int> MappedGraph<VertexObject, EdgeObject>::neighbors(int v)
+{
+	vector<int> result;
+	if ((v < 0) || (v >= _vertexCount)) return result;
+	result.assign(_targets + _offsets[v], _targets + _offsets[v + 1]);
+	return result;
+}
+
+//displayNeighbors():  displays the neighbors of a vertex into an ostream
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::displayNeighbors(int v, ostream& os)
+{
+	_checkVertex(v);
+	vector<int> neighborList = neighbors(v);
+	this->printVector(neighborList, os);
+}
+
+//returns the number of neighbors of v
+template <class VertexObject, class EdgeObject>
+int MappedGraph<VertexObject, EdgeObject>::degree(int v)
+{
+	_checkVertex(v);
+	return _offsets[v + 1] - _offsets[v];
+}
+
+//returns a pointer to the first neighbor of v; neighbors are in ascending order
+template <class VertexObject, class EdgeObject>
+const int* MappedGraph<VertexObject, EdgeObject>::neighborBegin(int v)
+{
+	_checkVertex(v);
+	return _targets + _offsets[v];
+}
+
+//returns a pointer one past the last neighbor of v
+template <class VertexObject, class EdgeObject>
+const int* MappedGraph<VertexObject, EdgeObject>::neighborEnd(int v)
+{
+	_checkVertex(v);
+	return _targets + _offsets[v + 1];
+}
+
+//returns a pointer to the weights parallel to v's neighbors
+template <class VertexObject, class EdgeObject>
+const double* MappedGraph<VertexObject, EdgeObject>::weightBegin(int v)
+{
+	_checkVertex(v);
+	return _weights + _offsets[v];
+}
+
+//calls visit(w) for every neighbor w of v in ascending order
+template <class VertexObject, class EdgeObject>
+template <class Visitor>
+void MappedGraph<VertexObject, EdgeObject>::forEachNeighbor(int v, Visitor& visit)
+{
+	_checkVertex(v);
+	const int* p = _targets + _offsets[v];
+	const int* last = _targets + _offsets[v + 1];
+	for (; p < last; p++)
+		visit(*p);
+}
+
+//the mapped graph's structure cannot change
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::deleteEdge(int /*start*/, int /*end*/)
+{
+	throw GraphReadOnly();
+}
+
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::addEdge(int /*start*/, int /*end*/, double /*weight*/)
+{
+	throw GraphReadOnly();
+}
+
+template <class VertexObject, class EdgeObject>
+void MappedGraph<VertexObject, EdgeObject>::addEdge(int /*start*/, int /*end*/, double /*weight*/, EdgeObject& /*info*/)
+{
+	throw GraphReadOnly();
+}
+
+
+#endif	//_GRAPHFILE_H
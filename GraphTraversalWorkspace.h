@@ -0,0 +1,76 @@
+/*	GraphTraversalWorkspace.h
+*	GraphTraversalWorkspace holds the buffers a breadth-first or depth-first search needs:  a
+*	visited bitmap, the visit number of every vertex, the queue/stack, and the list of vertices
+*	reached.  A program that runs many traversals keeps one workspace and passes it to each
+*	search, so nothing is allocated once the buffers have grown to the graph's size.  Between
+*	searches only the entries the previous search touched are cleared.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _GRAPHTRAVERSALWORKSPACE_H
+#define _GRAPHTRAVERSALWORKSPACE_H
+
+#include <vector>
+#include <cstdint>
+
+using namespace std;
+
+class GraphTraversalWorkspace
+{
+public:
+	vector<uint64_t> visited;									//bit v is set once v has been reached
+	vector<int> order;											//visit number of each vertex, 0 if not reached
+	vector<int> buffer;											//queue or stack storage for the search
+	vector<int> touched;										//vertices reached, in visit order
+	vector<int> found;											//(frontier slot, vertex) pairs from a bottom-up step
+	vector<int> counts;											//counting-sort buckets for a bottom-up step
+	vector<uint64_t> frontier;									//bit v is set if v is in a bottom-up step's frontier
+
+	void reset(int n);											//prepares the workspace for a graph of n vertices
+	bool isVisited(int v) const;								//true if v has been reached
+	void visit(int v);											//marks v reached and gives it the next number
+};
+
+
+//reset():  sizes the buffers for n vertices and clears what the last search left behind
+inline void GraphTraversalWorkspace::reset(int n)
+{
+	int words = (n + 63) / 64;
+	if ((int)order.size() != n)
+	{
+		order.assign(n, 0);
+		visited.assign(words, 0);
+	}
+	else
+	{
+		for (unsigned int i = 0; i < touched.size(); i++)
+		{
+			int v = touched[i];
+			order[v] = 0;
+			visited[v >> 6] = 0;
+		}
+	}
+	touched.clear();
+	buffer.clear();
+	found.clear();
+	if ((int)buffer.capacity() < n) buffer.reserve(n);
+	if ((int)touched.capacity() < n) touched.reserve(n);
+}
+
+//returns true if v has already been reached
+inline bool GraphTraversalWorkspace::isVisited(int v) const
+{
+	return ((visited[v >> 6] >> (v & 63)) & 1) != 0;
+}
+
+//marks v as reached and numbers it; the first vertex reached is number 1
+inline void GraphTraversalWorkspace::visit(int v)
+{
+	visited[v >> 6] |= (uint64_t)1 << (v & 63);
+	touched.push_back(v);
+	order[v] = (int)touched.size();
+}
+
+
+#endif	//_GRAPHTRAVERSALWORKSPACE_H
@@ -0,0 +1,182 @@
+/*	MappedFile.h
+*	MappedFile maps a whole file into memory so that a saved structure can be searched in
+*	place instead of being read and rebuilt.  The mapping is either read-only or private
+*	copy-on-write; changes made through a copy-on-write mapping are never written back.
+*	Works with the Windows file mapping API and with POSIX mmap.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _MAPPEDFILE_H
+#define _MAPPEDFILE_H
+
+#include <cstddef>
+#include "Exception.h"
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+class MappedFileException : public Exception { };
+class MappedFileOpenError : public MappedFileException { };
+class MappedFileMapError : public MappedFileException { };
+
+
+class MappedFile
+{
+protected:
+	char* _data;												//start of the mapping, NULL if nothing mapped
+	size_t _size;												//length of the file in bytes
+#if defined(_WIN32)
+	HANDLE _file;
+	HANDLE _mapping;
+#else
+	int _fd;
+#endif
+
+	MappedFile(const MappedFile& mf);							//mappings are not copyable
+	void operator= (const MappedFile& mf);
+
+public:
+	MappedFile();												//creates an unopened mapping
+	MappedFile(const char* filename, bool copyOnWrite = false);	//maps filename
+	virtual ~MappedFile();										//unmaps and closes the file
+	void open(const char* filename, bool copyOnWrite = false);	//maps filename, closing any current file
+	void close();												//unmaps and closes the file
+	bool isOpen() const;										//true if a file is mapped
+	char* data() const;											//returns the start of the mapping
+	size_t size() const;										//returns the size of the mapping in bytes
+};
+
+
+//Empty constructor
+inline MappedFile::MappedFile()
+{
+	_data = NULL;
+	_size = 0;
+#if defined(_WIN32)
+	_file = INVALID_HANDLE_VALUE;
+	_mapping = NULL;
+#else
+	_fd = -1;
+#endif
+}
+
+//constructor that maps a file immediately
+inline MappedFile::MappedFile(const char* filename, bool copyOnWrite)
+{
+	_data = NULL;
+	_size = 0;
+#if defined(_WIN32)
+	_file = INVALID_HANDLE_VALUE;
+	_mapping = NULL;
+#else
+	_fd = -1;
+#endif
+	open(filename, copyOnWrite);
+}
+
+//Destructor
+inline MappedFile::~MappedFile()
+{
+	close();
+}
+
+//open():  maps the whole file.  An empty file is opened but has no mapping.
+inline void MappedFile::open(const char* filename, bool copyOnWrite)
+{
+	close();
+#if defined(_WIN32)
+	_file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, NULL);
+	if (_file == INVALID_HANDLE_VALUE) throw MappedFileOpenError();
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(_file, &fileSize))
+	{
+		close();
+		throw MappedFileOpenError();
+	}
+	_size = (size_t)fileSize.QuadPart;
+	if (_size == 0) return;
+	_mapping = CreateFileMappingA(_file, NULL, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, NULL);
+	if (_mapping == NULL)
+	{
+		close();
+		throw MappedFileMapError();
+	}
+	_data = (char*)MapViewOfFile(_mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+	if (_data == NULL)
+	{
+		close();
+		throw MappedFileMapError();
+	}
+#else
+	_fd = ::open(filename, O_RDONLY);
+	if (_fd < 0) throw MappedFileOpenError();
+	struct stat st;
+	if (fstat(_fd, &st) != 0)
+	{
+		close();
+		throw MappedFileOpenError();
+	}
+	_size = (size_t)st.st_size;
+	if (_size == 0) return;
+	int protection = copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+	void* p = mmap(NULL, _size, protection, MAP_PRIVATE, _fd, 0);
+	if (p == MAP_FAILED)
+	{
+		close();
+		throw MappedFileMapError();
+	}
+	_data = (char*)p;
+#endif
+}
+
+//close():  releases the mapping and the file handle
+inline void MappedFile::close()
+{
+#if defined(_WIN32)
+	if (_data != NULL) UnmapViewOfFile(_data);
+	if (_mapping != NULL) CloseHandle(_mapping);
+	if (_file != INVALID_HANDLE_VALUE) CloseHandle(_file);
+	_mapping = NULL;
+	_file = INVALID_HANDLE_VALUE;
+#else
+	if (_data != NULL) munmap(_data, _size);
+	if (_fd >= 0) ::close(_fd);
+	_fd = -1;
+#endif
+	_data = NULL;
+	_size = 0;
+}
+
+//returns true if a file is open
+inline bool MappedFile::isOpen() const
+{
+#if defined(_WIN32)
+	return (_file != INVALID_HANDLE_VALUE);
+#else
+	return (_fd >= 0);
+#endif
+}
+
+//returns the start of the mapped bytes
+inline char* MappedFile::data() const
+{
+	return _data;
+}
+
+//returns the number of mapped bytes
+inline size_t MappedFile::size() const
+{
+	return _size;
+}
+
+
+#endif	//_MAPPEDFILE_H
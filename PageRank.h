@@ -0,0 +1,295 @@
+/*	PageRank.h
+*	PageRank scores the vertices of a graph by iterating the random-surfer model to a fixed
+*	point.  The constructor takes a compact snapshot of the graph:  the in-edges of every vertex
+*	in one contiguous array (compressed sparse column form), with the edge weights beside them
+*	if the ranking is weighted.  Each iteration is then a pull-based sparse matrix-vector
+*	multiply:  a vertex sums the contributions of the vertices pointing at it, so every thread
+*	writes only its own vertices and no atomics or locks are needed.  The vertices are shared
+*	out over a ThreadPool in fixed chunks, and the per-chunk sums are added in chunk order, so
+*	the scores do not depend on how many threads ran.
+*
+*	Rank held by vertices with no out-edges is spread by the teleport distribution, which is
+*	uniform for ordinary PageRank and supplied by the caller for personalized PageRank.
+*	Iteration stops when the L1 change of the scores falls below the tolerance.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _PAGERANK_H
+#define _PAGERANK_H
+
+#include <vector>
+#include <cmath>
+#include <functional>
+#include <algorithm>
+#include "AbstractGraph.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+class GraphBadPersonalization : public GraphException { };
+
+const double PAGERANK_DAMPING = 0.85;
+const double PAGERANK_TOLERANCE = 1e-9;
+const int PAGERANK_MAX_ITERATIONS = 100;
+const int PAGERANK_CHUNK = 1024;								//vertices per work chunk
+
+
+class PageRank
+{
+protected:
+	ThreadPool& _pool;
+	int _vertexCount;
+	vector<int> _offsets;										//in-edges of v are _sources[_offsets[v] .. _offsets[v+1])
+	vector<int> _sources;										//start vertex of each in-edge
+	vector<double> _weights;									//weight of each in-edge, empty if unweighted
+	vector<double> _outWeight;									//out-degree or total out-weight of each vertex
+	vector<double> _rank;
+	vector<double> _contribution;								//rank / out-weight of each vertex
+	vector<double> _next;
+	vector<double> _teleport;									//teleport probability of each vertex
+	vector<double> _partial;									//per-chunk sums
+	double _damping;
+	double _tolerance;
+	int _maxIterations;
+	int _iterations;											//iterations taken by the last run
+	double _residual;											//L1 change in the last iteration
+
+	void _iterate();											//runs from the current _teleport
+	double _sumChunks(const function<double(int, int)>& body);	//parallel sum over vertex chunks
+
+public:
+	template <class VertexObject, class EdgeObject>
+	PageRank(AbstractGraph<VertexObject, EdgeObject>& g, ThreadPool& pool, bool weighted = false);
+	virtual ~PageRank();
+
+	void setDamping(double damping);							//probability of following an edge
+	void setTolerance(double tolerance);						//L1 change at which to stop
+	void setMaxIterations(int iterations);						//iteration limit
+	const vector<double>& run();								//ordinary PageRank, scores sum to 1
+	const vector<double>& run(const vector<double>& personalization);	//teleports in proportion to personalization
+	const vector<double>& ranks();								//scores of the last run
+	int iterations();											//iterations taken by the last run
+	double residual();											//final L1 change of the last run
+	void multiply(const vector<double>& x, vector<double>& y);	//y[v] = sum of weight(u, v) x[u] over in-edges
+};
+
+
+//constructor -- builds the in-edge snapshot.  The out-edges of every vertex are counted per
+//end vertex, and then placed by a counting sort, which leaves each in-edge list in ascending
+//order of start vertex.  With weighted, edges pass on rank in proportion to their weight.
+template <class VertexObject, class EdgeObject>
+PageRank::PageRank(AbstractGraph<VertexObject, EdgeObject>& g, ThreadPool& pool, bool weighted)
+	: _pool(pool)
+{
+	_vertexCount = g.vertexCount();
+	_damping = PAGERANK_DAMPING;
+	_tolerance = PAGERANK_TOLERANCE;
+	_maxIterations = PAGERANK_MAX_ITERATIONS;
+	_iterations = 0;
+	_residual = 0;
+
+	int n = _vertexCount;
+	vector<vector<int>> out(n);
+	_offsets.assign(n + 1, 0);
+	_outWeight.assign(n, 0.0);
+	for (int u = 0; u < n; u++)
+	{
+		out[u] = g.neighbors(u);
+		for (unsigned int i = 0; i < out[u].size(); i++)
+			_offsets[out[u][i] + 1]++;
+	}
+	for (int v = 0; v < n; v++)
+		_offsets[v + 1] += _offsets[v];
+
+	vector<int> position(_offsets.begin(), _offsets.end() - 1);
+	_sources.resize(_offsets[n]);
+	if (weighted) _weights.resize(_offsets[n]);
+	for (int u = 0; u < n; u++)
+	{
+		for (unsigned int i = 0; i < out[u].size(); i++)
+		{
+			int v = out[u][i];
+			int slot = position[v]++;
+			_sources[slot] = u;
+			if (weighted)
+			{
+				double weight = g.edgeWeight(u, v);
+				if (weight < 0) throw GraphNegativeEdgeWeight();
+				_weights[slot] = weight;
+				_outWeight[u] += weight;
+			}
+			else _outWeight[u] += 1.0;
+		}
+		vector<int>().swap(out[u]);
+	}
+
+	_rank.assign(n, (n > 0) ? 1.0 / n : 0.0);
+	_contribution.resize(n);
+	_next.resize(n);
+}
+
+//destructor
+inline PageRank::~PageRank() { }
+
+//sets the damping factor, the probability that the surfer follows an edge
+inline void PageRank::setDamping(double damping)
+{
+	_damping = damping;
+}
+
+//sets the L1 change of the scores below which iteration stops
+inline void PageRank::setTolerance(double tolerance)
+{
+	_tolerance = tolerance;
+}
+
+//sets the most iterations a run may take
+inline void PageRank::setMaxIterations(int iterations)
+{
+	_maxIterations = iterations;
+}
+
+//returns the scores of the last run
+inline const vector<double>& PageRank::ranks()
+{
+	return _rank;
+}
+
+//returns the number of iterations the last run took
+inline int PageRank::iterations()
+{
+	return _iterations;
+}
+
+//returns the L1 change of the scores in the final iteration of the last run
+inline double PageRank::residual()
+{
+	return _residual;
+}
+
+
+//_sumChunks():  calls body(low, high) for every fixed chunk of vertices across the pool and
+//adds the chunk results in chunk order
+inline double PageRank::_sumChunks(const function<double(int, int)>& body)
+{
+	int chunks = (_vertexCount + PAGERANK_CHUNK - 1) / PAGERANK_CHUNK;
+	_partial.assign(chunks, 0.0);
+	_pool.parallelFor(0, chunks, 1, [&](int low, int high, int /*thread*/)
+	{
+		for (int c = low; c < high; c++)
+			_partial[c] = body(c * PAGERANK_CHUNK, min(_vertexCount, (c + 1) * PAGERANK_CHUNK));
+	});
+	double sum = 0;
+	for (int c = 0; c < chunks; c++)
+		sum += _partial[c];
+	return sum;
+}
+
+//run():  ordinary PageRank with a uniform teleport distribution
+inline const vector<double>& PageRank::run()
+{
+	_teleport.assign(_vertexCount, (_vertexCount > 0) ? 1.0 / _vertexCount : 0.0);
+	_iterate();
+	return _rank;
+}
+
+//run():  personalized PageRank.  personalization gives a non-negative preference for every
+//vertex; it is scaled to sum to 1 and used as the teleport distribution.
+inline const vector<double>& PageRank::run(const vector<double>& personalization)
+{
+	if ((int)personalization.size() != _vertexCount) throw GraphBadPersonalization();
+	double total = 0;
+	for (int v = 0; v < _vertexCount; v++)
+	{
+		if (personalization[v] < 0) throw GraphBadPersonalization();
+		total += personalization[v];
+	}
+	if (total <= 0) throw GraphBadPersonalization();
+	_teleport.resize(_vertexCount);
+	for (int v = 0; v < _vertexCount; v++)
+		_teleport[v] = personalization[v] / total;
+	_iterate();
+	return _rank;
+}
+
+//_iterate():  power iteration from the teleport distribution.  Each step computes every
+//vertex's outgoing share, collects the rank of dangling vertices, then pulls the shares along
+//the in-edges into the new scores.
+inline void PageRank::_iterate()
+{
+	_rank = _teleport;
+	_iterations = 0;
+	_residual = 0;
+	bool weighted = !_weights.empty();
+	while (_iterations < _maxIterations)
+	{
+		double dangling = _sumChunks([&](int low, int high)
+		{
+			double lost = 0;
+			for (int u = low; u < high; u++)
+			{
+				if (_outWeight[u] > 0)
+					_contribution[u] = _rank[u] / _outWeight[u];
+				else
+				{
+					_contribution[u] = 0;
+					lost += _rank[u];
+				}
+			}
+			return lost;
+		});
+
+		double teleportShare = (1.0 - _damping) + _damping * dangling;
+		_residual = _sumChunks([&](int low, int high)
+		{
+			const int* sources = _sources.data();
+			const double* contribution = _contribution.data();
+			double change = 0;
+			for (int v = low; v < high; v++)
+			{
+				double sum = 0;
+				int last = _offsets[v + 1];
+				if (weighted)
+				{
+					const double* weights = _weights.data();
+					for (int e = _offsets[v]; e < last; e++)
+						sum += weights[e] * contribution[sources[e]];
+				}
+				else
+				{
+					for (int e = _offsets[v]; e < last; e++)
+						sum += contribution[sources[e]];
+				}
+				_next[v] = _damping * sum + teleportShare * _teleport[v];
+				change += fabs(_next[v] - _rank[v]);
+			}
+			return change;
+		});
+		_rank.swap(_next);
+		_iterations++;
+		if (_residual < _tolerance) break;
+	}
+}
+
+//multiply():  the pull product y = A^T x over the snapshot, with A[u][v] the weight of edge
+//(u, v), or 1 if the snapshot is unweighted.  y is resized to the number of vertices.
+inline void PageRank::multiply(const vector<double>& x, vector<double>& y)
+{
+	if ((int)x.size() != _vertexCount) throw GraphVertexOutOfBounds();
+	y.resize(_vertexCount);
+	bool weighted = !_weights.empty();
+	_pool.parallelFor(0, _vertexCount, PAGERANK_CHUNK, [&](int low, int high, int /*thread*/)
+	{
+		for (int v = low; v < high; v++)
+		{
+			double sum = 0;
+			for (int e = _offsets[v]; e < _offsets[v + 1]; e++)
+				sum += (weighted ? _weights[e] : 1.0) * x[_sources[e]];
+			y[v] = sum;
+		}
+	});
+}
+
+
+#endif	//_PAGERANK_H
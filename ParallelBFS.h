@@ -0,0 +1,174 @@
+/*	ParallelBFS.h
+*	ParallelBFS runs a level-synchronous breadth-first search on a ThreadPool.  Each level's
+*	frontier is split into chunks that the threads take in turn; a thread claims an unvisited
+*	neighbor with an atomic compare-and-swap and keeps the vertices it claimed in its own
+*	buffer, and the buffers are merged into the next frontier between levels.
+*
+*	A vertex is claimed with an atomic minimum of the frontier positions that reach it, so its
+*	parent is the earliest frontier vertex adjacent to it - the same vertex a serial search
+*	would pick.  The merged level is ordered by parent position, which makes the BFS numbers
+*	and the parent vector identical to AdjacencyMatrixGraph::breadthFirstSearch() no matter how
+*	the threads were scheduled.
+*
+*	The graph class must provide vertexCount() and forEachNeighbor(v, visit) listing neighbors
+*	in ascending order, as AdjacencyMatrixGraph, CSRGraph and BitAdjacencyGraph do.  Reading a
+*	graph from several threads is safe as long as nothing modifies it during the search.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _PARALLELBFS_H
+#define _PARALLELBFS_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <climits>
+#include <algorithm>
+#include "AbstractGraph.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+const int PARALLEL_BFS_CHUNK = 64;								//frontier vertices per work chunk
+
+
+class ParallelBFS
+{
+protected:
+	ThreadPool& _pool;
+	unique_ptr<atomic<int>[]> _claim;							//smallest frontier slot that reached each vertex
+	int _capacity;												//size of _claim
+	vector<vector<int>> _local;									//vertices claimed by each thread this level
+	vector<int> _counts;										//counting-sort buckets for merging a level
+	vector<int> _merged;										//claimed vertices of a level, unordered
+	long long _edgesTraversed;									//neighbor entries examined by the last search
+
+public:
+	ParallelBFS(ThreadPool& pool);								//searches run on pool
+	virtual ~ParallelBFS();
+
+	template <class GraphType>
+	vector<int> search(GraphType& g, int u, vector<int> &parent);	//returns bfs numbers, fills parent
+	long long edgesTraversed();									//edges examined by the last search, for TEPS
+};
+
+
+//constructor
+inline ParallelBFS::ParallelBFS(ThreadPool& pool)
+	: _pool(pool)
+{
+	_capacity = 0;
+	_edgesTraversed = 0;
+	_local.resize(pool.threadCount());
+}
+
+//destructor
+inline ParallelBFS::~ParallelBFS() { }
+
+//returns the number of neighbor entries the last search examined.  Divide by the search time
+//to get traversed edges per second.
+inline long long ParallelBFS::edgesTraversed()
+{
+	return _edgesTraversed;
+}
+
+
+//search():  bfs from u.  Returns the bfs number of every vertex (1 for u, 0 if unreached) and
+//sets parent[w] for every reached vertex, parent[u] = -1.
+template <class GraphType>
+vector<int> ParallelBFS::search(GraphType& g, int u, vector<int> &parent)
+{
+	int n = g.vertexCount();
+	if ((u < 0) || (u >= n)) throw GraphVertexOutOfBounds();
+	if (_capacity < n)
+	{
+		_claim.reset(new atomic<int>[n]);
+		_capacity = n;
+	}
+	for (int i = 0; i < n; i++)
+		_claim[i].store(INT_MAX, memory_order_relaxed);
+
+	vector<int> BFSnums(n, 0);
+	vector<int> order;											//vertices in bfs order; levels are contiguous
+	order.reserve(n);
+	order.push_back(u);
+	BFSnums[u] = 1;
+	parent[u] = -1;
+	vector<long long> edgeCounts(_pool.threadCount(), 0);
+
+	int levelStart = 0;
+	while (levelStart < (int)order.size())
+	{
+		int levelEnd = (int)order.size();
+		for (unsigned int t = 0; t < _local.size(); t++)
+			_local[t].clear();
+
+		//expand the frontier order[levelStart, levelEnd) in parallel
+		_pool.parallelFor(levelStart, levelEnd, PARALLEL_BFS_CHUNK, [&](int low, int high, int thread)
+		{
+			vector<int>& local = _local[thread];
+			long long examined = 0;
+			for (int slot = low; slot < high; slot++)
+			{
+				int v = order[slot];
+				auto visit = [&](int w)
+				{
+					examined++;
+					if (BFSnums[w] != 0) return;				//reached on an earlier level
+					int current = _claim[w].load(memory_order_relaxed);
+					while (slot < current)
+					{
+						if (_claim[w].compare_exchange_weak(current, slot, memory_order_relaxed))
+						{
+							if (current == INT_MAX) local.push_back(w);	//first claim this level
+							break;
+						}
+					}
+				};
+				g.forEachNeighbor(v, visit);
+			}
+			edgeCounts[thread] += examined;
+		});
+
+		//merge the thread buffers, ordered by the frontier slot of each vertex's parent
+		_merged.clear();
+		for (unsigned int t = 0; t < _local.size(); t++)
+			_merged.insert(_merged.end(), _local[t].begin(), _local[t].end());
+		int frontierSize = levelEnd - levelStart;
+		_counts.assign(frontierSize + 1, 0);
+		for (unsigned int i = 0; i < _merged.size(); i++)
+			_counts[_claim[_merged[i]].load(memory_order_relaxed) - levelStart + 1]++;
+		for (int s = 0; s < frontierSize; s++)
+			_counts[s + 1] += _counts[s];
+		order.resize(levelEnd + _merged.size());
+		for (unsigned int i = 0; i < _merged.size(); i++)
+		{
+			int w = _merged[i];
+			order[levelEnd + _counts[_claim[w].load(memory_order_relaxed) - levelStart]++] = w;
+		}
+
+		//within one parent the vertices must be in ascending order, as a serial scan finds them
+		for (int s = 0, first = levelEnd; s < frontierSize; s++)
+		{
+			int last = levelEnd + _counts[s];
+			sort(order.begin() + first, order.begin() + last);
+			first = last;
+		}
+		for (int i = levelEnd; i < (int)order.size(); i++)
+		{
+			int w = order[i];
+			BFSnums[w] = i + 1;
+			parent[w] = order[_claim[w].load(memory_order_relaxed)];
+		}
+		levelStart = levelEnd;
+	}
+
+	_edgesTraversed = 0;
+	for (unsigned int t = 0; t < edgeCounts.size(); t++)
+		_edgesTraversed += edgeCounts[t];
+	return BFSnums;
+}
+
+
+#endif	//_PARALLELBFS_H
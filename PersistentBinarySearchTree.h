@@ -0,0 +1,382 @@
+/*	PersistentBinarySearchTree.h
+*	PersistentBinarySearchTree is an immutable-node binary search tree.  insert() and remove()
+*	never change an existing node; they copy only the nodes on the path from the root to the
+*	change and share every other subtree with the previous version.  snapshot() is O(1) and
+*	returns a tree that keeps seeing the same contents while the original continues to change.
+*
+*	The tree is a treap:  every node carries a random priority and a node's priority is never
+*	below its children's.  Its shape is that of a tree built by inserting in random order
+*	whatever order the data really arrived in, so the height is O(log n) with high probability
+*	and sorted input does not degrade it.  An update copies O(log n) nodes, and the recursion
+*	in the updates and in freeing a version stays as shallow as the tree.
+*
+*	Nodes are reference counted with shared_ptr, so a version is freed as soon as the last
+*	tree or snapshot that can reach it goes away.  The root is published atomically, so
+*	readers may take snapshots while writers update the tree; concurrent writers retry on
+*	conflict rather than lock.  Under C++20 the root is an atomic<shared_ptr>, and before it
+*	the atomic shared_ptr free functions, which C++20 deprecates, are used instead.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _PERSISTENTBINARYSEARCHTREE_H
+#define _PERSISTENTBINARYSEARCHTREE_H
+
+#include <iostream>
+#include <algorithm>
+#include <memory>
+#include <atomic>
+#include "Exception.h"
+#include "BinarySearchTree.h"
+
+using namespace std;
+
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+#define PERSISTENT_TREE_ATOMIC_SHARED_PTR
+#endif
+
+
+//PersistentTreeNode -- a node that is never modified after it has been constructed
+template <class DataType>
+class PersistentTreeNode
+{
+public:
+	typedef shared_ptr<const PersistentTreeNode<DataType>> NodePtr;
+
+	const DataType data;										//data stored at the node
+	const unsigned int priority;								//treap priority, at least that of either child
+	const NodePtr left;											//left subtree, NULL if empty
+	const NodePtr right;										//right subtree, NULL if empty
+
+	PersistentTreeNode(const DataType& d, unsigned int p, const NodePtr& l, const NodePtr& r)
+		: data(d), priority(p), left(l), right(r) { }
+};
+
+
+template <class DataType>
+class PersistentBinarySearchTree
+{
+protected:
+	typedef typename PersistentTreeNode<DataType>::NodePtr NodePtr;
+
+#ifdef PERSISTENT_TREE_ATOMIC_SHARED_PTR
+	atomic<NodePtr> _root;										//current version
+#else
+	NodePtr _root;												//current version, accessed atomically
+#endif
+
+	PersistentBinarySearchTree(const NodePtr& root);			//creates a tree sharing root
+	NodePtr _loadRoot() const;									//atomically reads the current root
+	void _storeRoot(const NodePtr& root);						//atomically replaces the current root
+	bool _exchangeRoot(NodePtr& expected, const NodePtr& root);	//replaces the root if it is still expected
+	static unsigned int _nextPriority();						//returns a random priority for a new node
+	static NodePtr _makeNode(const DataType& data, unsigned int priority, const NodePtr& left, const NodePtr& right);
+	static NodePtr _insert(const NodePtr& node, const DataType& data, unsigned int priority);	//returns new root with data
+	static NodePtr _remove(const NodePtr& node, const DataType& data);	//returns new root without data
+	static NodePtr _merge(const NodePtr& low, const NodePtr& high);	//joins two subtrees, low before high
+	static int _height(const NodePtr& node);
+	static int _size(const NodePtr& node);
+	static void _inOrderDisplay(const NodePtr& node);
+
+public:
+	PersistentBinarySearchTree();								//empty constructor
+	PersistentBinarySearchTree(const PersistentBinarySearchTree<DataType>& t);	//O(1) copy of t's version
+	virtual ~PersistentBinarySearchTree();						//destructor
+	void operator= (const PersistentBinarySearchTree<DataType>& t);	//O(1) assignment of t's version
+	PersistentBinarySearchTree<DataType> snapshot() const;		//O(1) point-in-time view of the tree
+	void makeEmpty();											//drops this tree's reference to its nodes
+
+	bool isEmpty() const;										//true if tree is empty, false otherwise
+	int Height() const;											//returns height of tree
+	int Size() const;											//returns number of nodes in tree
+	DataType rootData() const;									//returns data from root
+	bool contains(const DataType& q) const;						//returns true if tree contains a node with q
+	DataType find(const DataType& q) const;						//returns a node that matches q or throws exception
+	void insert(const DataType& data);							//inserts data, copying the path to the change
+	void remove(const DataType& data);							//removes the node matching data or throws
+	void inOrderDisplay() const;								//displays the tree in sorted order
+};
+
+
+//Empty constructor
+template <class DataType>
+PersistentBinarySearchTree<DataType>::PersistentBinarySearchTree() { }
+
+//constructor that shares an existing version
+template <class DataType>
+PersistentBinarySearchTree<DataType>::PersistentBinarySearchTree(const NodePtr& root)
+{
+	_storeRoot(root);
+}
+
+//copy constructor -- shares the source's current version, O(1)
+template <class DataType>
+PersistentBinarySearchTree<DataType>::PersistentBinarySearchTree(const PersistentBinarySearchTree<DataType>& t)
+{
+	_storeRoot(t._loadRoot());
+}
+
+//Destructor -- nodes no longer reachable from any version are freed by their reference counts
+template <class DataType>
+PersistentBinarySearchTree<DataType>::~PersistentBinarySearchTree() { }
+
+//overloaded = operator:  makes this tree share t's current version
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::operator= (const PersistentBinarySearchTree<DataType>& t)
+{
+	if (&t != this)
+		_storeRoot(t._loadRoot());
+}
+
+//returns a tree that will keep the current contents regardless of later updates
+template <class DataType>
+PersistentBinarySearchTree<DataType> PersistentBinarySearchTree<DataType>::snapshot() const
+{
+	return PersistentBinarySearchTree<DataType>(_loadRoot());
+}
+
+//releases this tree's version; snapshots taken earlier are unaffected
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::makeEmpty()
+{
+	_storeRoot(NodePtr());
+}
+
+//reads the root atomically
+template <class DataType>
+typename PersistentBinarySearchTree<DataType>::NodePtr PersistentBinarySearchTree<DataType>::_loadRoot() const
+{
+#ifdef PERSISTENT_TREE_ATOMIC_SHARED_PTR
+	return _root.load();
+#else
+	return atomic_load(&_root);
+#endif
+}
+
+//replaces the root atomically
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::_storeRoot(const NodePtr& root)
+{
+#ifdef PERSISTENT_TREE_ATOMIC_SHARED_PTR
+	_root.store(root);
+#else
+	atomic_store(&_root, root);
+#endif
+}
+
+//replaces the root with root if it is still expected and returns true; otherwise loads the
+//current root into expected and returns false
+template <class DataType>
+bool PersistentBinarySearchTree<DataType>::_exchangeRoot(NodePtr& expected, const NodePtr& root)
+{
+#ifdef PERSISTENT_TREE_ATOMIC_SHARED_PTR
+	return _root.compare_exchange_strong(expected, root);
+#else
+	return atomic_compare_exchange_strong(&_root, &expected, root);
+#endif
+}
+
+//returns a pseudo-random priority:  a shared counter stepped by the golden ratio and mixed,
+//which any number of threads may call at once
+template <class DataType>
+unsigned int PersistentBinarySearchTree<DataType>::_nextPriority()
+{
+	static atomic<unsigned int> counter(0x2545F491u);
+	unsigned int x = counter.fetch_add(0x9E3779B9u, memory_order_relaxed);
+	x ^= x >> 16;
+	x *= 0x7FEB352Du;
+	x ^= x >> 15;
+	x *= 0x846CA68Bu;
+	x ^= x >> 16;
+	return x;
+}
+
+//allocates a new immutable node
+template <class DataType>
+typename PersistentBinarySearchTree<DataType>::NodePtr PersistentBinarySearchTree<DataType>::_makeNode
+	(const DataType& data, unsigned int priority, const NodePtr& left, const NodePtr& right)
+{
+	NodePtr node = make_shared<const PersistentTreeNode<DataType>>(data, priority, left, right);
+	if (node == NULL) throw BinaryTreeMemory();
+	return node;
+}
+
+
+//checks to see whether or not the tree is empty
+template <class DataType>
+bool PersistentBinarySearchTree<DataType>::isEmpty() const
+{
+	return (_loadRoot() == NULL);
+}
+
+//returns the height of the tree
+template <class DataType>
+int PersistentBinarySearchTree<DataType>::Height() const
+{
+	return _height(_loadRoot());
+}
+
+template <class DataType>
+int PersistentBinarySearchTree<DataType>::_height(const NodePtr& node)
+{
+	if (node == NULL) return 0;
+	return (1 + std::max(_height(node->left), _height(node->right)));
+}
+
+//returns the number of nodes in the tree
+template <class DataType>
+int PersistentBinarySearchTree<DataType>::Size() const
+{
+	return _size(_loadRoot());
+}
+
+template <class DataType>
+int PersistentBinarySearchTree<DataType>::_size(const NodePtr& node)
+{
+	if (node == NULL) return 0;
+	return (1 + _size(node->left) + _size(node->right));
+}
+
+//returns the data at the root of the current version
+template <class DataType>
+DataType PersistentBinarySearchTree<DataType>::rootData() const
+{
+	NodePtr root = _loadRoot();
+	if (root == NULL) throw BinaryTreeEmptyTree();
+	return root->data;
+}
+
+
+//returns true if data is found in the tree, false otherwise
+template <class DataType>
+bool PersistentBinarySearchTree<DataType>::contains(const DataType& q) const
+{
+	NodePtr root = _loadRoot();									//holds the version for the whole search
+	const PersistentTreeNode<DataType>* node = root.get();
+	while (node != NULL)
+	{
+		if (node->data < q)
+			node = node->right.get();
+		else if (node->data > q)
+			node = node->left.get();
+		else
+			return true;
+	}
+	return false;
+}
+
+//returns contents of node if data is found, exception otherwise
+template <class DataType>
+DataType PersistentBinarySearchTree<DataType>::find(const DataType& q) const
+{
+	NodePtr root = _loadRoot();
+	const PersistentTreeNode<DataType>* node = root.get();
+	while (node != NULL)
+	{
+		if (node->data < q)
+			node = node->right.get();
+		else if (node->data > q)
+			node = node->left.get();
+		else
+			return node->data;
+	}
+	throw BinarySearchTreeNotFound();
+}
+
+
+//returns a new subtree containing data; only the nodes on the search path are copied.  A new
+//node goes in as a leaf and is rotated up, one copied node at a time, past every ancestor of
+//lower priority.
+template <class DataType>
+typename PersistentBinarySearchTree<DataType>::NodePtr PersistentBinarySearchTree<DataType>::_insert
+	(const NodePtr& node, const DataType& data, unsigned int priority)
+{
+	if (node == NULL)
+		return _makeNode(data, priority, NodePtr(), NodePtr());
+	if (node->data < data)
+	{
+		NodePtr right = _insert(node->right, data, priority);
+		if (right->priority > node->priority)					//rotate left
+			return _makeNode(right->data, right->priority,
+				_makeNode(node->data, node->priority, node->left, right->left), right->right);
+		return _makeNode(node->data, node->priority, node->left, right);
+	}
+	if (node->data > data)
+	{
+		NodePtr left = _insert(node->left, data, priority);
+		if (left->priority > node->priority)					//rotate right
+			return _makeNode(left->data, left->priority, left->left,
+				_makeNode(node->data, node->priority, left->right, node->right));
+		return _makeNode(node->data, node->priority, left, node->right);
+	}
+	return _makeNode(data, node->priority, node->left, node->right);	//overwrite, as in BinarySearchTree
+}
+
+//inserts data and publishes the new version, retrying if another writer got there first
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::insert(const DataType& data)
+{
+	unsigned int priority = _nextPriority();
+	NodePtr oldRoot = _loadRoot();
+	NodePtr newRoot = _insert(oldRoot, data, priority);
+	while (!_exchangeRoot(oldRoot, newRoot))
+		newRoot = _insert(oldRoot, data, priority);
+}
+
+
+//returns a subtree holding the nodes of low and then of high, every key in low being smaller
+//than every key in high.  Only the right spine of low and the left spine of high are copied.
+template <class DataType>
+typename PersistentBinarySearchTree<DataType>::NodePtr PersistentBinarySearchTree<DataType>::_merge
+	(const NodePtr& low, const NodePtr& high)
+{
+	if (low == NULL) return high;
+	if (high == NULL) return low;
+	if (low->priority > high->priority)
+		return _makeNode(low->data, low->priority, low->left, _merge(low->right, high));
+	return _makeNode(high->data, high->priority, _merge(low, high->left), high->right);
+}
+
+//returns a new subtree without data, exception if data is not present
+template <class DataType>
+typename PersistentBinarySearchTree<DataType>::NodePtr PersistentBinarySearchTree<DataType>::_remove
+	(const NodePtr& node, const DataType& data)
+{
+	if (node == NULL) throw BinarySearchTreeNotFound();
+	if (node->data < data)
+		return _makeNode(node->data, node->priority, node->left, _remove(node->right, data));
+	if (node->data > data)
+		return _makeNode(node->data, node->priority, _remove(node->left, data), node->right);
+	return _merge(node->left, node->right);						//found the node:  join its subtrees
+}
+
+//removes data and publishes the new version, retrying if another writer got there first
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::remove(const DataType& data)
+{
+	NodePtr oldRoot = _loadRoot();
+	NodePtr newRoot = _remove(oldRoot, data);
+	while (!_exchangeRoot(oldRoot, newRoot))
+		newRoot = _remove(oldRoot, data);
+}
+
+
+//displays the tree in sorted order
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::inOrderDisplay() const
+{
+	_inOrderDisplay(_loadRoot());
+}
+
+template <class DataType>
+void PersistentBinarySearchTree<DataType>::_inOrderDisplay(const NodePtr& node)
+{
+	if (node == NULL)
+		return;
+	_inOrderDisplay(node->left);
+	cout << node->data << " ";
+	_inOrderDisplay(node->right);
+}
+
+
+#endif	//_PERSISTENTBINARYSEARCHTREE_H
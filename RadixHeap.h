@@ -0,0 +1,134 @@
+/*	RadixHeap.h
+*	RadixHeap is a monotone priority queue for non-negative integer keys:  no key pushed may be
+*	smaller than the last key popped, which always holds in Dijkstra's algorithm.  An entry is
+*	kept in the bucket named by the highest bit in which its key differs from the last key
+*	popped, so a push is O(1) and each entry moves to a lower bucket at most 64 times.  There is
+*	no decrease-key; a caller pushes an item again with its new key and skips stale entries when
+*	they are popped.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _RADIXHEAP_H
+#define _RADIXHEAP_H
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include "IndexedHeap.h"
+#include "BitOperations.h"
+
+using namespace std;
+
+class HeapNotMonotone : public HeapException { };
+
+const int RADIX_HEAP_BUCKETS = 65;								//bucket 0 holds keys equal to the last pop
+
+
+class RadixHeap
+{
+protected:
+	vector<pair<uint64_t, int>> _buckets[RADIX_HEAP_BUCKETS];	//(key, item) entries
+	uint64_t _last;												//last key popped
+	int _size;
+
+	int _bucket(uint64_t key) const;							//bucket that key belongs in
+	void _refill();												//moves the smallest bucket into bucket 0
+
+public:
+	RadixHeap();
+	virtual ~RadixHeap();
+
+	bool isEmpty() const;										//true if the heap holds no entries
+	int Size() const;											//returns the number of entries
+	void push(int item, uint64_t key);							//adds an entry, key >= last key popped
+	uint64_t topKey();											//returns the smallest key
+	int pop();													//removes an entry with the smallest key
+	void clear();												//empties the heap
+};
+
+
+//constructor
+inline RadixHeap::RadixHeap()
+{
+	_last = 0;
+	_size = 0;
+}
+
+//destructor
+inline RadixHeap::~RadixHeap() { }
+
+//returns the bucket for key:  one more than the index of the highest bit that differs from _last
+inline int RadixHeap::_bucket(uint64_t key) const
+{
+	return (key == _last) ? 0 : 64 - countLeadingZeros(key ^ _last);
+}
+
+//returns true if the heap is empty
+inline bool RadixHeap::isEmpty() const
+{
+	return _size == 0;
+}
+
+//returns the number of entries in the heap
+inline int RadixHeap::Size() const
+{
+	return _size;
+}
+
+//push():  adds item with key; throws if key is below the last key popped
+inline void RadixHeap::push(int item, uint64_t key)
+{
+	if (key < _last) throw HeapNotMonotone();
+	_buckets[_bucket(key)].push_back(make_pair(key, item));
+	_size++;
+}
+
+//_refill():  if bucket 0 is empty, takes the first non-empty bucket, makes its smallest key the
+//new _last and spreads its entries over the lower buckets, which puts the minimum in bucket 0
+inline void RadixHeap::_refill()
+{
+	if (!_buckets[0].empty()) return;
+	int i = 1;
+	while (_buckets[i].empty())
+		i++;
+	vector<pair<uint64_t, int>>& source = _buckets[i];
+	uint64_t smallest = source[0].first;
+	for (unsigned int j = 1; j < source.size(); j++)
+		if (source[j].first < smallest) smallest = source[j].first;
+	_last = smallest;
+	for (unsigned int j = 0; j < source.size(); j++)
+		_buckets[_bucket(source[j].first)].push_back(source[j]);
+	source.clear();
+}
+
+//returns the smallest key in the heap
+inline uint64_t RadixHeap::topKey()
+{
+	if (_size == 0) throw HeapEmpty();
+	_refill();
+	return _last;
+}
+
+//pop():  removes an entry whose key is the smallest and returns its item
+inline int RadixHeap::pop()
+{
+	if (_size == 0) throw HeapEmpty();
+	_refill();
+	int item = _buckets[0].back().second;
+	_buckets[0].pop_back();
+	_size--;
+	return item;
+}
+
+//clear():  empties the heap and resets it so any key may be pushed
+inline void RadixHeap::clear()
+{
+	for (int i = 0; i < RADIX_HEAP_BUCKETS; i++)
+		_buckets[i].clear();
+	_last = 0;
+	_size = 0;
+}
+
+
+#endif	//_RADIXHEAP_H
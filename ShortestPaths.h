@@ -0,0 +1,258 @@
+/*	ShortestPaths.h
+*	ShortestPaths answers single-source and point-to-point shortest path queries on a weighted
+*	graph.  The constructor copies the graph's adjacency and weights into compact arrays once,
+*	so the searches read neighbors from contiguous memory instead of calling neighbors() and
+*	edgeWeight() through the graph's virtual interface for every edge.  Rebuild the object if
+*	the graph changes.
+*
+*	Searches run Dijkstra's algorithm on an IndexedHeap, or on a RadixHeap when every weight is a
+*	whole number.  A point-to-point query stops as soon as the target is settled, and aStar()
+*	takes a heuristic giving a lower bound on the distance from any vertex to the target.  Only
+*	the vertices a search reached are cleared before the next one, so repeated short queries on a
+*	large graph do not pay O(V) each.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _SHORTESTPATHS_H
+#define _SHORTESTPATHS_H
+
+#include <vector>
+#include <limits>
+#include <cmath>
+#include <functional>
+#include <algorithm>
+#include "AbstractGraph.h"
+#include "IndexedHeap.h"
+#include "RadixHeap.h"
+
+using namespace std;
+
+enum ShortestPathHeap
+{
+	SHORTEST_PATH_DARY_HEAP,									//4-ary indexed heap, any weights
+	SHORTEST_PATH_RADIX_HEAP									//radix heap, whole-number weights
+};
+
+const double SHORTEST_PATH_INFINITY = numeric_limits<double>::infinity();
+
+
+class ShortestPaths
+{
+protected:
+	int _vertexCount;
+	vector<int> _offsets;										//row v is _targets[_offsets[v] .. _offsets[v+1])
+	vector<int> _targets;										//neighbor of each edge
+	vector<double> _weights;									//weight of each edge
+	bool _integral;												//true if every weight is a whole number
+	ShortestPathHeap _heapType;
+
+	vector<double> _dist;										//tentative distance, infinity if unreached
+	vector<int> _parent;										//previous vertex on the best path, -1 if none
+	vector<int> _touched;										//vertices whose distance was set
+	IndexedHeap<double> _heap;
+	RadixHeap _radixHeap;
+	long long _settledCount;									//vertices removed from the heap by the last search
+
+	void _reset();												//clears what the last search left behind
+	void _checkVertex(int v);
+	void _search(int source, int target, const function<double(int)>* heuristic);
+	void _dijkstraRadix(int source, int target);
+	double _path(int target, vector<int>& path);				//reads the path to target from _parent
+
+public:
+	template <class VertexObject, class EdgeObject>
+	ShortestPaths(AbstractGraph<VertexObject, EdgeObject>& g);	//copies the graph; throws on negative weights
+	virtual ~ShortestPaths();
+
+	void setHeap(ShortestPathHeap heapType);					//chooses the priority queue for Dijkstra
+	ShortestPathHeap heap();									//returns the priority queue in use
+	void singleSource(int source, vector<double>& dist, vector<int>& parent);	//distances to every vertex
+	double shortestPath(int source, int target, vector<int>& path);	//stops once target is settled
+	double aStar(int source, int target, const function<double(int)>& heuristic, vector<int>& path);
+	long long settledCount();									//vertices settled by the last search
+};
+
+
+//constructor -- takes a snapshot of the adjacency and weights of g
+template <class VertexObject, class EdgeObject>
+ShortestPaths::ShortestPaths(AbstractGraph<VertexObject, EdgeObject>& g)
+{
+	_vertexCount = g.vertexCount();
+	_integral = true;
+	_heapType = SHORTEST_PATH_DARY_HEAP;
+	_settledCount = 0;
+	_offsets.resize(_vertexCount + 1);
+	_offsets[0] = 0;
+	for (int v = 0; v < _vertexCount; v++)
+	{
+		vector<int> nbors = g.neighbors(v);
+		for (unsigned int i = 0; i < nbors.size(); i++)
+		{
+			double weight = g.edgeWeight(v, nbors[i]);
+			if (weight < 0) throw GraphNegativeEdgeWeight();
+			if ((weight != floor(weight)) || (weight > 9007199254740992.0)) _integral = false;	//2^53
+			_targets.push_back(nbors[i]);
+			_weights.push_back(weight);
+		}
+		_offsets[v + 1] = (int)_targets.size();
+	}
+	_dist.assign(_vertexCount, SHORTEST_PATH_INFINITY);
+	_parent.assign(_vertexCount, -1);
+	_heap.resize(_vertexCount);
+}
+
+//destructor
+inline ShortestPaths::~ShortestPaths() { }
+
+
+//setHeap():  selects the priority queue.  The radix heap needs whole-number weights and throws
+//GraphNonIntegerWeight otherwise.  aStar() always uses the indexed heap.
+inline void ShortestPaths::setHeap(ShortestPathHeap heapType)
+{
+	if ((heapType == SHORTEST_PATH_RADIX_HEAP) && (!_integral)) throw GraphNonIntegerWeight();
+	_heapType = heapType;
+}
+
+//returns the priority queue used by Dijkstra's algorithm
+inline ShortestPathHeap ShortestPaths::heap()
+{
+	return _heapType;
+}
+
+//returns the number of vertices the last search settled, a measure of the work it did
+inline long long ShortestPaths::settledCount()
+{
+	return _settledCount;
+}
+
+//throws if v is not a vertex
+inline void ShortestPaths::_checkVertex(int v)
+{
+	if ((v < 0) || (v >= _vertexCount)) throw GraphVertexOutOfBounds();
+}
+
+//_reset():  restores the distance and parent of the vertices the last search touched
+inline void ShortestPaths::_reset()
+{
+	for (unsigned int i = 0; i < _touched.size(); i++)
+	{
+		_dist[_touched[i]] = SHORTEST_PATH_INFINITY;
+		_parent[_touched[i]] = -1;
+	}
+	_touched.clear();
+	_heap.clear();
+	_radixHeap.clear();
+	_settledCount = 0;
+}
+
+//_search():  Dijkstra or A* on the indexed heap from source, stopping when target (if not -1)
+//is settled.  The heap is keyed by distance plus heuristic.  A vertex whose distance improves
+//after it was settled is pushed again, so an admissible heuristic that is not consistent still
+//gives shortest paths.
+inline void ShortestPaths::_search(int source, int target, const function<double(int)>* heuristic)
+{
+	_dist[source] = 0;
+	_touched.push_back(source);
+	_heap.push(source, (heuristic) ? (*heuristic)(source) : 0.0);
+	while (!_heap.isEmpty())
+	{
+		int v = _heap.pop();
+		_settledCount++;
+		if (v == target) return;
+		double base = _dist[v];
+		for (int e = _offsets[v]; e < _offsets[v + 1]; e++)
+		{
+			int w = _targets[e];
+			double candidate = base + _weights[e];
+			if (candidate < _dist[w])
+			{
+				if (_dist[w] == SHORTEST_PATH_INFINITY) _touched.push_back(w);
+				_dist[w] = candidate;
+				_parent[w] = v;
+				_heap.push(w, (heuristic) ? candidate + (*heuristic)(w) : candidate);
+			}
+		}
+	}
+}
+
+//_dijkstraRadix():  Dijkstra on the radix heap.  An improved vertex is pushed again and the
+//stale entry is skipped when its key no longer matches the vertex's distance.
+inline void ShortestPaths::_dijkstraRadix(int source, int target)
+{
+	_dist[source] = 0;
+	_touched.push_back(source);
+	_radixHeap.push(source, 0);
+	while (!_radixHeap.isEmpty())
+	{
+		uint64_t key = _radixHeap.topKey();
+		int v = _radixHeap.pop();
+		if ((double)key != _dist[v]) continue;					//a shorter path was found later
+		_settledCount++;
+		if (v == target) return;
+		for (int e = _offsets[v]; e < _offsets[v + 1]; e++)
+		{
+			int w = _targets[e];
+			double candidate = _dist[v] + _weights[e];
+			if (candidate < _dist[w])
+			{
+				if (_dist[w] == SHORTEST_PATH_INFINITY) _touched.push_back(w);
+				_dist[w] = candidate;
+				_parent[w] = v;
+				_radixHeap.push(w, (uint64_t)candidate);
+			}
+		}
+	}
+}
+
+//_path():  fills path with the vertices from the last search's source to target and returns
+//the distance, or returns infinity with an empty path if target was not reached
+inline double ShortestPaths::_path(int target, vector<int>& path)
+{
+	path.clear();
+	if (_dist[target] == SHORTEST_PATH_INFINITY) return SHORTEST_PATH_INFINITY;
+	for (int v = target; v != -1; v = _parent[v])
+		path.push_back(v);
+	reverse(path.begin(), path.end());
+	return _dist[target];
+}
+
+
+//singleSource():  shortest distances from source to every vertex.  dist[v] is infinity and
+//parent[v] is -1 for a vertex that cannot be reached; parent[source] is -1.
+inline void ShortestPaths::singleSource(int source, vector<double>& dist, vector<int>& parent)
+{
+	_checkVertex(source);
+	_reset();
+	if (_heapType == SHORTEST_PATH_RADIX_HEAP) _dijkstraRadix(source, -1);
+	else _search(source, -1, NULL);
+	dist = _dist;
+	parent = _parent;
+}
+
+//shortestPath():  returns the distance from source to target and fills path with the vertices
+//along a shortest path.  The search stops as soon as target is settled.
+inline double ShortestPaths::shortestPath(int source, int target, vector<int>& path)
+{
+	_checkVertex(source);
+	_checkVertex(target);
+	_reset();
+	if (_heapType == SHORTEST_PATH_RADIX_HEAP) _dijkstraRadix(source, target);
+	else _search(source, target, NULL);
+	return _path(target, path);
+}
+
+//aStar():  like shortestPath(), but the search is guided by heuristic(v), which must never
+//exceed the true distance from v to target.  A good heuristic (for example straight-line
+//distance on a road map) settles far fewer vertices than Dijkstra's algorithm.
+inline double ShortestPaths::aStar(int source, int target, const function<double(int)>& heuristic, vector<int>& path)
+{
+	_checkVertex(source);
+	_checkVertex(target);
+	_reset();
+	_search(source, target, &heuristic);
+	return _path(target, path);
+}
+
+
+#endif	//_SHORTESTPATHS_H
@@ -0,0 +1,237 @@
+/*	SparseEdgeData.h
+*	SparseEdgeData holds the EdgeObject of each edge that has one, for graphs whose structure is
+*	kept somewhere else (an adjacency matrix or bit matrix).  It is an open-addressing hash table
+*	keyed by the (start, end) pair, with linear probing and no tombstones:  a removal shifts the
+*	following entries of its run back into place.  Memory grows with the number of edges that
+*	carry data and nothing is allocated until the first one is stored, where a dense n x n
+*	matrix would default-construct V^2 objects up front.
+*
+*	read() never changes the table:  for an edge without data it returns a default object that
+*	is never written, so a pass that reads the info of every edge leaves the table as it was and
+*	any number of threads may read at once.  get() is the writable path:  an edge without data
+*	is given a default entry through set(), and the reference returned is that entry's slot, so
+*	writes through it are stored.  A reference returned by get(), read() or find() stays valid
+*	until an edge is added or erased.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _SPARSEEDGEDATA_H
+#define _SPARSEEDGEDATA_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace std;
+
+const uint64_t SPARSE_EDGE_EMPTY = ~(uint64_t)0;				//key of an unused slot
+const size_t SPARSE_EDGE_MIN_CAPACITY = 16;
+
+
+template <class EdgeObject>
+class SparseEdgeData
+{
+protected:
+	vector<uint64_t> _keys;										//edge key of each slot, SPARSE_EDGE_EMPTY if unused
+	vector<EdgeObject> _values;									//data of each slot
+	int _size;													//number of edges stored
+	size_t _mask;												//capacity - 1, capacity a power of 2
+	EdgeObject _default;										//returned by read() for an edge without data, never written
+
+	static uint64_t _key(int start, int end);
+	static size_t _hash(uint64_t key);
+	size_t _slot(uint64_t key) const;							//slot holding key, or the empty slot ending its run
+	void _rehash(size_t capacity);
+
+public:
+	SparseEdgeData();											//empty table, nothing allocated
+	virtual ~SparseEdgeData();
+
+	int Size() const;											//returns the number of edges stored
+	bool isEmpty() const;										//true if no edge has data
+	bool contains(int start, int end) const;					//true if (start, end) has data
+	EdgeObject* find(int start, int end);						//data of (start, end), NULL if none
+	EdgeObject& get(int start, int end);						//data of (start, end), stored as a default if none
+	const EdgeObject& read(int start, int end) const;			//data of (start, end), a default object if none
+	void set(int start, int end, const EdgeObject& info);		//stores the data of (start, end)
+	bool erase(int start, int end);								//removes (start, end), false if it had no data
+	void clear();												//removes everything and frees the table
+};
+
+
+//constructor
+template <class EdgeObject>
+SparseEdgeData<EdgeObject>::SparseEdgeData()
+{
+	_size = 0;
+	_mask = 0;
+	_default = EdgeObject();
+}
+
+//destructor
+template <class EdgeObject>
+SparseEdgeData<EdgeObject>::~SparseEdgeData() { }
+
+//packs an edge into one key
+template <class EdgeObject>
+uint64_t SparseEdgeData<EdgeObject>::_key(int start, int end)
+{
+	return ((uint64_t)(uint32_t)start << 32) | (uint32_t)end;
+}
+
+//mixes all bits of the key into the low bits used to pick a slot
+template <class EdgeObject>
+size_t SparseEdgeData<EdgeObject>::_hash(uint64_t key)
+{
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdULL;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ULL;
+	key ^= key >> 33;
+	return (size_t)key;
+}
+
+//_slot():  probes from the key's home slot until it finds the key or an empty slot
+template <class EdgeObject>
+size_t SparseEdgeData<EdgeObject>::_slot(uint64_t key) const
+{
+	size_t i = _hash(key) & _mask;
+	while ((_keys[i] != key) && (_keys[i] != SPARSE_EDGE_EMPTY))
+		i = (i + 1) & _mask;
+	return i;
+}
+
+//_rehash():  moves every entry into a new table of the given capacity
+template <class EdgeObject>
+void SparseEdgeData<EdgeObject>::_rehash(size_t capacity)
+{
+	vector<uint64_t> oldKeys;
+	vector<EdgeObject> oldValues;
+	oldKeys.swap(_keys);
+	oldValues.swap(_values);
+	_keys.assign(capacity, SPARSE_EDGE_EMPTY);
+	_values.resize(capacity);
+	_mask = capacity - 1;
+	for (size_t i = 0; i < oldKeys.size(); i++)
+	{
+		if (oldKeys[i] == SPARSE_EDGE_EMPTY) continue;
+		size_t slot = _slot(oldKeys[i]);
+		_keys[slot] = oldKeys[i];
+		_values[slot] = oldValues[i];
+	}
+}
+
+//returns the number of edges with data
+template <class EdgeObject>
+int SparseEdgeData<EdgeObject>::Size() const
+{
+	return _size;
+}
+
+//returns true if no edge has data
+template <class EdgeObject>
+bool SparseEdgeData<EdgeObject>::isEmpty() const
+{
+	return (_size == 0);
+}
+
+//returns true if (start, end) has data
+template <class EdgeObject>
+bool SparseEdgeData<EdgeObject>::contains(int start, int end) const
+{
+	if (_keys.empty()) return false;
+	return (_keys[_slot(_key(start, end))] != SPARSE_EDGE_EMPTY);
+}
+
+//returns a pointer to the data of (start, end), NULL if it has none
+template <class EdgeObject>
+EdgeObject* SparseEdgeData<EdgeObject>::find(int start, int end)
+{
+	if (_keys.empty()) return NULL;
+	size_t slot = _slot(_key(start, end));
+	if (_keys[slot] == SPARSE_EDGE_EMPTY) return NULL;
+	return &_values[slot];
+}
+
+//get():  returns the data of (start, end).  An edge without data is first given a default
+//entry with set(), so the reference is always the edge's own slot and writes through it stay.
+template <class EdgeObject>
+EdgeObject& SparseEdgeData<EdgeObject>::get(int start, int end)
+{
+	EdgeObject* found = find(start, end);
+	if (found != NULL) return *found;
+	set(start, end, EdgeObject());
+	return *find(start, end);
+}
+
+//read():  returns the data of (start, end) without changing the table.  An edge without data
+//gets the table's default object, which nothing writes, so concurrent reads are safe.
+template <class EdgeObject>
+const EdgeObject& SparseEdgeData<EdgeObject>::read(int start, int end) const
+{
+	if (_keys.empty()) return _default;
+	size_t slot = _slot(_key(start, end));
+	if (_keys[slot] == SPARSE_EDGE_EMPTY) return _default;
+	return _values[slot];
+}
+
+//set():  stores the data of (start, end), replacing any it had.  Only a new edge can grow the
+//table, which is kept at most half full.
+template <class EdgeObject>
+void SparseEdgeData<EdgeObject>::set(int start, int end, const EdgeObject& info)
+{
+	EdgeObject* found = find(start, end);
+	if (found != NULL)
+	{
+		*found = info;
+		return;
+	}
+	if ((size_t)(_size + 1) * 2 > _keys.size())
+		_rehash((_keys.empty()) ? SPARSE_EDGE_MIN_CAPACITY : _keys.size() * 2);
+	uint64_t key = _key(start, end);
+	size_t slot = _slot(key);
+	_keys[slot] = key;
+	_values[slot] = info;
+	_size++;
+}
+
+//erase():  removes the data of (start, end).  The entries after it in the same run are shifted
+//back over the gap unless their home slot lies between the gap and where they sit.
+template <class EdgeObject>
+bool SparseEdgeData<EdgeObject>::erase(int start, int end)
+{
+	if (_keys.empty()) return false;
+	size_t gap = _slot(_key(start, end));
+	if (_keys[gap] == SPARSE_EDGE_EMPTY) return false;
+	size_t i = (gap + 1) & _mask;
+	while (_keys[i] != SPARSE_EDGE_EMPTY)
+	{
+		size_t home = _hash(_keys[i]) & _mask;
+		bool stays = (gap <= i) ? ((gap < home) && (home <= i)) : ((gap < home) || (home <= i));
+		if (!stays)
+		{
+			_keys[gap] = _keys[i];
+			_values[gap] = _values[i];
+			gap = i;
+		}
+		i = (i + 1) & _mask;
+	}
+	_keys[gap] = SPARSE_EDGE_EMPTY;
+	_values[gap] = EdgeObject();
+	_size--;
+	return true;
+}
+
+//clear():  removes all data and releases the table
+template <class EdgeObject>
+void SparseEdgeData<EdgeObject>::clear()
+{
+	vector<uint64_t>().swap(_keys);
+	vector<EdgeObject>().swap(_values);
+	_size = 0;
+	_mask = 0;
+}
+
+
+#endif	//_SPARSEEDGEDATA_H
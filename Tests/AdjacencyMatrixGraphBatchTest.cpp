@@ -0,0 +1,232 @@
+/*	AdjacencyMatrixGraphBatchTest.cpp
+*	Test and benchmark driver for applyBatch() of AdjacencyMatrixGraph.  Random batches, with
+*	repeated entries, self loops and edges in both lists, are applied to undirected graphs,
+*	directed graphs and directed graphs with the in-edge index, with one pool thread and several,
+*	and compared with a copy given the same changes one addEdge() or deleteEdge() at a time:  the
+*	edges, weights, in-edge lists, edge count and number of edges changed must agree.  A batch
+*	must erase the info of the edges it deletes, give an edge it adds again its new weight and
+*	keep its info, refuse a batch with a bad end or weight without changing anything, and wait for
+*	a reader holding the batch lock.  The benchmark measures updates per second of applyBatch()
+*	and of single-edge calls.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <shared_mutex>
+#include "AdjacencyMatrixGraph.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//m random edges over n vertices with weights 1 to 9, every twentieth a self loop
+vector<GraphEdge> randomEdges(int n, int m, unsigned int& seed)
+{
+	vector<GraphEdge> edgeList(m);
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = (i % 20 == 0) ? edgeList[i].start : (int)(nextRandom(seed) % n);
+		edgeList[i].weight = 1 + nextRandom(seed) % 9;
+	}
+	return edgeList;
+}
+
+//applies a batch one edge at a time, deletions first, and returns the edges changed.  An
+//edge added again is re-added with its new weight but not counted.
+template <class GraphType>
+int applySingly(GraphType& g, const vector<GraphEdge>& additions, const vector<GraphEdge>& deletions)
+{
+	int changed = 0;
+	for (unsigned int i = 0; i < deletions.size(); i++)
+	{
+		if (!g.hasEdge(deletions[i].start, deletions[i].end)) continue;
+		g.deleteEdge(deletions[i].start, deletions[i].end);
+		changed++;
+	}
+	for (unsigned int i = 0; i < additions.size(); i++)
+	{
+		const GraphEdge& e = additions[i];
+		if (g.hasEdge(e.start, e.end))
+		{
+			if (g.edgeWeight(e.start, e.end) == e.weight) continue;
+			g.deleteEdge(e.start, e.end);
+			changed--;
+		}
+		g.addEdge(e.start, e.end, e.weight);
+		changed++;
+	}
+	return changed;
+}
+
+//true if both graphs have the same edges, weights, in-edge lists and edge count
+bool sameEdges(AdjacencyMatrixGraph<int, int>& a, AdjacencyMatrixGraph<int, int>& b)
+{
+	if ((a.vertexCount() != b.vertexCount()) || (a.edgeCount() != b.edgeCount())) return false;
+	for (int v = 0; v < a.vertexCount(); v++)
+	{
+		vector<int> nbors = a.neighbors(v);
+		if ((nbors != b.neighbors(v)) || (a.inNeighbors(v) != b.inNeighbors(v))) return false;
+		for (unsigned int i = 0; i < nbors.size(); i++)
+			if (a.edgeWeight(v, nbors[i]) != b.edgeWeight(v, nbors[i])) return false;
+	}
+	return true;
+}
+
+//random batches in one mode, against single-edge changes
+void testMode(bool directed, bool indexInEdges, int threads, const char* what)
+{
+	const int n = 150;
+	AdjacencyMatrixGraph<int, int> batched(n, directed, indexInEdges);
+	AdjacencyMatrixGraph<int, int> single(n, directed, indexInEdges);
+	ThreadPool pool(threads);
+	unsigned int seed = 83 + 4 * directed + 2 * indexInEdges + threads;
+	bool ok = true;
+	for (int round = 0; round < 30; round++)
+	{
+		vector<GraphEdge> additions = randomEdges(n, 1 + nextRandom(seed) % 800, seed);
+		vector<GraphEdge> deletions = randomEdges(n, nextRandom(seed) % 600, seed);
+		for (int i = 0; i < 40; i++)
+		{
+			additions.push_back(additions[nextRandom(seed) % additions.size()]);
+			deletions.push_back(additions[nextRandom(seed) % additions.size()]);
+		}
+		int changed = batched.applyBatch(additions, deletions, pool);
+		ok = ok && (changed == applySingly(single, additions, deletions)) && (batched.version() == round + 1);
+		ok = ok && sameEdges(batched, single);
+	}
+	check(ok, what);
+}
+
+//a deleted edge loses its info, and a bad batch changes nothing
+void testInfoAndErrors()
+{
+	ThreadPool pool(2);
+	AdjacencyMatrixGraph<int, int> g(10, true, true);
+	g.addEdge(1, 2);
+	g.addEdge(3, 4);
+	int info = 42;
+	g.setEdgeInfo(1, 2, info);
+	g.setEdgeInfo(3, 4, info);
+	GraphEdge e12 = { 1, 2, 1.0 }, e34 = { 3, 4, 1.0 };
+	int changed = g.applyBatch(vector<GraphEdge>(1, e12), vector<GraphEdge>(1, e12), pool);
+	check((changed == 2) && g.hasEdge(1, 2) && (g.edgeInfo(1, 2) == 0) && (g.edgeInfo(3, 4) == 42),
+		"an edge deleted and added again in one batch has no info");
+	changed = g.applyBatch(vector<GraphEdge>(1, e34), vector<GraphEdge>(), pool);
+	check((changed == 0) && (g.edgeCount() == 2) && (g.version() == 2), "adding an edge that is there changes no count");
+	vector<GraphEdge> reweighted(2, e34);
+	reweighted[0].weight = 7.0;
+	reweighted[1].weight = 2.5;
+	changed = g.applyBatch(reweighted, vector<GraphEdge>(), pool);
+	check((changed == 0) && (g.edgeWeight(3, 4) == 2.5) && (g.edgeInfo(3, 4) == 42) && (g.version() == 3),
+		"adding an edge again stores the last weight given and keeps its info");
+
+	g.removeVertex(7);
+	GraphEdge bad[] = { { 0, 10, 1.0 }, { -1, 0, 1.0 }, { 7, 0, 1.0 } };
+	int threw = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		vector<GraphEdge> additions(1, e34);
+		additions[0].start = 5;
+		additions.push_back(bad[i]);
+		try { g.applyBatch(additions, vector<GraphEdge>(1, e12), pool); }
+		catch (GraphEdgeOutOfBounds&) { threw++; }
+	}
+	vector<GraphEdge> additions(1, e34);
+	additions[0].start = 5;
+	additions.push_back(e12);
+	additions[1].weight = 0.0;
+	try { g.applyBatch(additions, vector<GraphEdge>(1, e12), pool); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	check((threw == 4) && g.hasEdge(1, 2) && !g.hasEdge(5, 4) && (g.version() == 3),
+		"a batch with a bad end or weight throws before changing anything");
+}
+
+//a batch waits while a reader holds the lock shared
+void testLock()
+{
+	ThreadPool pool(2);
+	AdjacencyMatrixGraph<int, int> g(20);
+	unsigned int seed = 89;
+	vector<GraphEdge> additions = randomEdges(20, 50, seed);
+	atomic<bool> done(false);
+	long long before = g.version();
+	shared_lock<shared_timed_mutex> reading(g.batchLock());
+	thread writer([&]()
+	{
+		g.applyBatch(additions, vector<GraphEdge>(), pool);
+		done = true;
+	});
+	this_thread::sleep_for(chrono::milliseconds(100));
+	bool waited = !done && (g.version() == before) && (g.edgeCount() == 0);
+	reading.unlock();
+	writer.join();
+	check(waited && done && (g.version() == before + 1) && (g.edgeCount() > 0), "a batch waits for readers holding the lock");
+}
+
+//updates per second of one large batch and of the same changes made one edge at a time
+void benchmark(int n, int updates, bool directed, bool indexInEdges, int threads)
+{
+	AdjacencyMatrixGraph<int, int> batched(n, directed, indexInEdges);
+	AdjacencyMatrixGraph<int, int> single(n, directed, indexInEdges);
+	ThreadPool pool(threads);
+	unsigned int seed = 97;
+	vector<GraphEdge> initial = randomEdges(n, updates, seed);
+	batched.applyBatch(initial, vector<GraphEdge>(), pool);
+	single.applyBatch(initial, vector<GraphEdge>(), pool);
+	vector<GraphEdge> additions = randomEdges(n, updates / 2, seed);
+	vector<GraphEdge> deletions = randomEdges(n, updates / 4, seed);
+	deletions.insert(deletions.end(), initial.begin(), initial.begin() + updates / 4);
+
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	int changed[2];
+	changed[0] = batched.applyBatch(additions, deletions, pool);
+	double batchSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	started = chrono::steady_clock::now();
+	changed[1] = applySingly(single, additions, deletions);
+	double singleSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	check((changed[0] == changed[1]) && (batched.edgeCount() == single.edgeCount()), "benchmark graphs agree");
+	cout << "  " << n << " vertices, " << (directed ? (indexInEdges ? "directed with in-edge index" : "directed") : "undirected")
+		<< ", " << updates << " updates, " << threads << " threads:  applyBatch " << (updates / batchSeconds / 1e6)
+		<< " M/s, single edges " << (updates / singleSeconds / 1e6) << " M/s" << endl;
+}
+
+int main()
+{
+	testMode(false, false, 1, "undirected batches match single-edge changes");
+	testMode(false, false, 4, "undirected batches on four threads match single-edge changes");
+	testMode(true, false, 4, "directed batches match single-edge changes");
+	testMode(true, true, 1, "indexed directed batches match single-edge changes");
+	testMode(true, true, 4, "indexed directed batches on four threads match single-edge changes");
+	testInfoAndErrors();
+	testLock();
+	cout << "AdjacencyMatrixGraph batch checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (updates per second):" << endl;
+	benchmark(4000, 2000000, false, false, 4);
+	benchmark(4000, 2000000, true, true, 4);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+/*	AdjacencyMatrixGraphDirectedTest.cpp
+*	Test and benchmark driver for the directed mode, in-edge index and edge count of
+*	AdjacencyMatrixGraph.  Random additions and deletions, self loops included, are applied to
+*	undirected graphs, directed graphs and directed graphs with the in-edge index, and checked
+*	against a set of edges:  hasEdge(), neighbors(), inNeighbors(), forEachInNeighbor() and
+*	edgeCount() must all agree with it, as must a copy and a graph built with loadEdges().  The
+*	benchmark lists the in-neighbors of every vertex with and without the index.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <chrono>
+#include "AdjacencyMatrixGraph.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//true if g holds exactly the edges of model, seen from both ends
+bool matches(AdjacencyMatrixGraph<int, int>& g, const set<pair<int, int>>& model, bool directed)
+{
+	int n = g.vertexCount();
+	int edges = 0;
+	for (set<pair<int, int>>::const_iterator e = model.begin(); e != model.end(); e++)
+		if (directed || (e->first <= e->second)) edges++;
+	if (g.edgeCount() != edges) return false;
+	for (int v = 0; v < n; v++)
+	{
+		vector<int> out, in;
+		for (int w = 0; w < n; w++)
+		{
+			if (model.count(make_pair(v, w))) out.push_back(w);
+			if (model.count(make_pair(w, v))) in.push_back(w);
+		}
+		if ((g.neighbors(v) != out) || (g.inNeighbors(v) != in)) return false;
+		vector<int> visited;
+		auto visit = [&](int w) { visited.push_back(w); };
+		g.forEachInNeighbor(v, visit);
+		if (visited != in) return false;
+	}
+	return true;
+}
+
+//random updates in one mode, checked against the model after every batch of them
+void testMode(bool directed, bool indexInEdges, const char* what)
+{
+	const int n = 60;
+	AdjacencyMatrixGraph<int, int> g(n, directed, indexInEdges);
+	check(g.directed() == directed, "directed() reports the mode");
+	check(g.indexesInEdges() == (directed && indexInEdges), "indexesInEdges() only for directed graphs");
+	set<pair<int, int>> model;
+	unsigned int seed = 17 + 2 * directed + indexInEdges;
+	bool ok = true;
+	for (int step = 0; step < 6000; step++)
+	{
+		int a = nextRandom(seed) % n;
+		int b = (nextRandom(seed) % 8 == 0) ? a : nextRandom(seed) % n;
+		bool present = model.count(make_pair(a, b)) == 1;
+		if (present && (nextRandom(seed) % 2 == 0))
+		{
+			g.deleteEdge(a, b);
+			model.erase(make_pair(a, b));
+			if (!directed) model.erase(make_pair(b, a));
+		}
+		else if (!present)
+		{
+			g.addEdge(a, b);
+			model.insert(make_pair(a, b));
+			if (!directed) model.insert(make_pair(b, a));
+		}
+		else
+		{
+			bool threw = false;
+			try { g.addEdge(a, b); }
+			catch (GraphDuplicateEdge&) { threw = true; }
+			ok = ok && threw;
+		}
+		if (step % 1000 == 999) ok = ok && matches(g, model, directed);
+	}
+	check(ok, what);
+
+	AdjacencyMatrixGraph<int, int> copied(g);
+	check(matches(copied, model, directed) && (copied.directed() == directed), "a copy keeps the mode and edges");
+
+	vector<GraphEdge> edgeList;
+	for (set<pair<int, int>>::iterator e = model.begin(); e != model.end(); e++)
+	{
+		GraphEdge edge = { e->first, e->second, 1.0 };
+		edgeList.push_back(edge);
+		edgeList.push_back(edge);
+	}
+	AdjacencyMatrixGraph<int, int> loaded(n, directed, indexInEdges);
+	loaded.loadEdges(edgeList);
+	check(matches(loaded, model, directed), "loadEdges() skips repeats and matches the model");
+}
+
+//deleting a directed edge leaves its reverse; deleting an undirected self loop works
+void testEdgeCases()
+{
+	AdjacencyMatrixGraph<int, int> directed(3, true, true);
+	directed.addEdge(0, 1);
+	directed.addEdge(1, 0);
+	directed.deleteEdge(0, 1);
+	check(directed.hasEdge(1, 0) && !directed.hasEdge(0, 1) && (directed.edgeCount() == 1),
+		"deleting a directed edge leaves its reverse");
+	check(directed.inNeighbors(0) == vector<int>(1, 1), "the in-edge index follows a deletion");
+
+	AdjacencyMatrixGraph<int, int> undirected(3);
+	undirected.addEdge(2, 2);
+	check(undirected.edgeCount() == 1, "an undirected self loop counts once");
+	undirected.deleteEdge(2, 2);
+	check(!undirected.hasEdge(2, 2) && (undirected.edgeCount() == 0), "an undirected self loop can be deleted");
+	bool threw = false;
+	try { undirected.deleteEdge(0, 1); }
+	catch (GraphEdgeOutOfBounds&) { threw = true; }
+	check(threw && (undirected.edgeCount() == 0), "deleting a missing edge throws and keeps the count");
+}
+
+//listing every in-neighbor list with the index and by scanning columns
+void benchmark(int n, int perVertex)
+{
+	AdjacencyMatrixGraph<int, int> indexed(n, true, true);
+	AdjacencyMatrixGraph<int, int> scanned(n, true, false);
+	vector<GraphEdge> edgeList;
+	unsigned int seed = 29;
+	for (int v = 0; v < n; v++)
+		for (int i = 0; i < perVertex; i++)
+		{
+			GraphEdge e = { v, (int)(nextRandom(seed) % n), 1.0 };
+			edgeList.push_back(e);
+		}
+	indexed.loadEdges(edgeList);
+	scanned.loadEdges(edgeList);
+
+	AdjacencyMatrixGraph<int, int>* graphs[2] = { &indexed, &scanned };
+	long long sums[2] = { 0, 0 };
+	double seconds[2];
+	for (int g = 0; g < 2; g++)
+	{
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int v = 0; v < n; v++)
+		{
+			auto add = [&](int w) { sums[g] += w; };
+			graphs[g]->forEachInNeighbor(v, add);
+		}
+		seconds[g] = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	}
+	check(sums[0] == sums[1], "benchmark listings agree");
+	cout << "  " << n << " vertices, " << indexed.edgeCount() << " edges:  in-edge index " << (seconds[0] * 1e3)
+		<< " ms, column scan " << (seconds[1] * 1e3) << " ms for every in-neighbor list" << endl;
+}
+
+int main()
+{
+	testMode(false, false, "an undirected graph matches the model");
+	testMode(true, false, "a directed graph matches the model");
+	testMode(true, true, "a directed graph with the in-edge index matches the model");
+	testEdgeCases();
+	cout << "AdjacencyMatrixGraph directed mode checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(4000, 16);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+/*	AdjacencyMatrixGraphVerticesTest.cpp
+*	Test and benchmark driver for addVertex(), removeVertex() and setVertexCount() of
+*	AdjacencyMatrixGraph.  Random vertex and edge changes are applied to undirected graphs,
+*	directed graphs and directed graphs with the in-edge index, and checked against a model:
+*	freed ids must come back last-in first-out, a removed vertex must lose its edges and data and
+*	refuse new ones, the other ids must never move, and the capacity must grow by doubling.  A
+*	copy must keep the free list, and shrinking must drop the free ids past the new end.  The
+*	benchmark grows a graph one vertex at a time and compares it with rebuilding the graph.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <cstdint>
+#include "AdjacencyMatrixGraph.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//the vertices, free ids, data and edges a graph should have
+struct Model
+{
+	int vertexCount;
+	vector<int> freeIds;
+	vector<int> info;
+	set<pair<int, int>> edges;
+	bool directed;
+};
+
+//true if the vertex ids in use, their data and their edges match the model
+bool matches(AdjacencyMatrixGraph<int, int>& g, const Model& model)
+{
+	int n = model.vertexCount;
+	if ((g.vertexCount() != n) || (g.liveVertexCount() != n - (int)model.freeIds.size()) || (g.capacity() < n))
+		return false;
+	int edges = 0;
+	for (set<pair<int, int>>::const_iterator e = model.edges.begin(); e != model.edges.end(); e++)
+		if (model.directed || (e->first <= e->second)) edges++;
+	if (g.edgeCount() != edges) return false;
+	for (int v = 0; v < n; v++)
+	{
+		bool removed = false;
+		for (unsigned int i = 0; i < model.freeIds.size(); i++)
+			removed = removed || (model.freeIds[i] == v);
+		if ((g.isVertex(v) == removed) || (g.vertexInfo(v) != model.info[v])) return false;
+		vector<int> out, in;
+		for (int w = 0; w < n; w++)
+		{
+			if (model.edges.count(make_pair(v, w))) out.push_back(w);
+			if (model.edges.count(make_pair(w, v))) in.push_back(w);
+		}
+		if ((g.neighbors(v) != out) || (g.inNeighbors(v) != in)) return false;
+	}
+	return !g.isVertex(-1) && !g.isVertex(n);
+}
+
+//removes every edge at v from the model
+void dropEdges(Model& model, int v)
+{
+	set<pair<int, int>> kept;
+	for (set<pair<int, int>>::iterator e = model.edges.begin(); e != model.edges.end(); e++)
+		if ((e->first != v) && (e->second != v)) kept.insert(*e);
+	model.edges.swap(kept);
+}
+
+//random vertex and edge changes in one mode
+void testMode(bool directed, bool indexInEdges, const char* what)
+{
+	AdjacencyMatrixGraph<int, int> g(5, directed, indexInEdges);
+	Model model = { 5, vector<int>(), vector<int>(5, 0), set<pair<int, int>>(), directed };
+	unsigned int seed = 71 + 2 * directed + indexInEdges;
+	bool ok = true, doubling = true, refused = true;
+	int lastCapacity = g.capacity();
+	for (int step = 0; step < 4000; step++)
+	{
+		int op = nextRandom(seed) % 10;
+		int n = model.vertexCount;
+		if (op < 2)
+		{
+			int info = step;
+			int expected = model.freeIds.empty() ? n : model.freeIds.back();
+			int v = g.addVertex(info);
+			ok = ok && (v == expected);
+			if (model.freeIds.empty()) model.vertexCount++;
+			else model.freeIds.pop_back();
+			if (v == (int)model.info.size()) model.info.push_back(info);
+			else model.info[v] = info;
+		}
+		else if ((op < 4) && (n > 0))
+		{
+			int v = nextRandom(seed) % n;
+			if (!g.isVertex(v)) continue;
+			g.removeVertex(v);
+			model.freeIds.push_back(v);
+			model.info[v] = 0;
+			dropEdges(model, v);
+			bool threw = false;
+			try { g.addEdge(v, v == 0 ? 1 : 0); }
+			catch (GraphEdgeOutOfBounds&) { threw = true; }
+			refused = refused && threw;
+		}
+		else if (n > 0)
+		{
+			int a = nextRandom(seed) % n;
+			int b = nextRandom(seed) % n;
+			if (!g.isVertex(a) || !g.isVertex(b)) continue;
+			if (model.edges.count(make_pair(a, b)))
+			{
+				g.deleteEdge(a, b);
+				model.edges.erase(make_pair(a, b));
+				if (!directed) model.edges.erase(make_pair(b, a));
+			}
+			else
+			{
+				g.addEdge(a, b);
+				model.edges.insert(make_pair(a, b));
+				if (!directed) model.edges.insert(make_pair(b, a));
+			}
+		}
+		if (g.capacity() != lastCapacity)
+		{
+			doubling = doubling && (g.capacity() == 2 * lastCapacity);
+			lastCapacity = g.capacity();
+		}
+		if (step % 500 == 499) ok = ok && matches(g, model);
+	}
+	ok = ok && matches(g, model);
+	check(ok, what);
+	check(doubling, "the capacity doubles when it grows");
+	check(refused, "a removed vertex refuses new edges");
+
+	AdjacencyMatrixGraph<int, int> copied(g);
+	bool sameNext = true;
+	if (!model.freeIds.empty()) sameNext = (copied.addVertex() == model.freeIds.back()) && !g.isVertex(model.freeIds.back());
+	check(matches(g, model) && sameNext, "a copy keeps the free list and leaves the source alone");
+}
+
+//shrinking and growing with setVertexCount(), and the errors
+void testVertexCount()
+{
+	AdjacencyMatrixGraph<int, int> g(10, true, true);
+	g.addEdge(1, 8);
+	g.addEdge(8, 2);
+	g.addEdge(3, 4);
+	g.removeVertex(9);
+	g.removeVertex(2);
+	g.setVertexCount(6);
+	check((g.vertexCount() == 6) && (g.edgeCount() == 1) && g.hasEdge(3, 4) && g.neighbors(1).empty(),
+		"shrinking deletes the edges of the dropped vertices");
+	check((g.liveVertexCount() == 5) && (g.addVertex() == 2) && (g.addVertex() == 6),
+		"shrinking drops the free ids past the new end");
+	g.setVertexCount(40);
+	check((g.vertexCount() == 40) && (g.capacity() >= 40) && g.isVertex(39) && g.inNeighbors(39).empty(),
+		"growing adds vertices without edges");
+
+	int threw = 0;
+	try { g.removeVertex(40); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	g.removeVertex(5);
+	try { g.removeVertex(5); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	try { g.setVertexCount(-1); }
+	catch (GraphNegativeCount&) { threw++; }
+	check(threw == 3, "bad vertex operations throw");
+
+	AdjacencyMatrixGraph<int, int> empty;
+	int info = 12;
+	check((empty.addVertex(info) == 0) && (empty.addVertex() == 1) && (empty.vertexInfo(0) == 12) && (empty.capacity() == 2),
+		"an empty graph grows from nothing");
+}
+
+//growing to n vertices one at a time, each joined to a few earlier ones
+template <class WeightType>
+double growByAddVertex(int n, int perVertex, int& edges)
+{
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	AdjacencyMatrixGraph<int, int, WeightType> g;
+	unsigned int seed = 73;
+	for (int i = 0; i < n; i++)
+	{
+		int v = g.addVertex();
+		for (int k = 0; (k < perVertex) && (v > 0); k++)
+		{
+			int w = nextRandom(seed) % v;
+			if (!g.hasEdge(v, w)) g.addEdge(v, w);
+		}
+	}
+	edges = g.edgeCount();
+	return chrono::duration<double>(chrono::steady_clock::now() - started).count();
+}
+
+//the same growth done by building a graph one vertex larger and reloading the edges each time
+double growByRebuild(int n, int perVertex, int& edges)
+{
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	vector<GraphEdge> edgeList;
+	unsigned int seed = 73;
+	AdjacencyMatrixGraph<int, int>* g = new AdjacencyMatrixGraph<int, int>(0);
+	for (int v = 0; v < n; v++)
+	{
+		for (int k = 0; (k < perVertex) && (v > 0); k++)
+		{
+			GraphEdge e = { v, (int)(nextRandom(seed) % v), 1.0 };
+			edgeList.push_back(e);
+		}
+		delete g;
+		g = new AdjacencyMatrixGraph<int, int>(v + 1);
+		g->loadEdges(edgeList);
+	}
+	edges = g->edgeCount();
+	delete g;
+	return chrono::duration<double>(chrono::steady_clock::now() - started).count();
+}
+
+//growth by addVertex() against rebuilding, then a long stream of ids freed and reused
+void benchmark(int rebuilt, int streamed)
+{
+	int edges[2];
+	double seconds[2] = { growByAddVertex<double>(rebuilt, 4, edges[0]), growByRebuild(rebuilt, 4, edges[1]) };
+	check(edges[0] == edges[1], "benchmark graphs agree");
+	cout << "  " << rebuilt << " vertices, " << edges[0] << " edges:  addVertex " << (seconds[0] * 1e3)
+		<< " ms, rebuild per vertex " << (seconds[1] * 1e3) << " ms" << endl;
+
+	seconds[0] = growByAddVertex<uint8_t>(streamed, 4, edges[0]);
+	cout << "  " << streamed << " vertices, " << edges[0] << " edges, uint8_t weights:  addVertex "
+		<< (seconds[0] * 1e3) << " ms" << endl;
+
+	AdjacencyMatrixGraph<int, int, uint8_t> g(4096);
+	unsigned int seed = 79;
+	vector<GraphEdge> edgeList(16384);
+	for (int i = 0; i < 16384; i++)
+	{
+		GraphEdge e = { i % 4096, (int)(nextRandom(seed) % 4096), 1.0 };
+		edgeList[i] = e;
+	}
+	g.loadEdges(edgeList);
+	int capacity = g.capacity();
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	for (int i = 0; i < 100000; i++)
+	{
+		int v = nextRandom(seed) % 4096;
+		if (!g.isVertex(v)) continue;
+		g.removeVertex(v);
+		g.addVertex();
+	}
+	double churnSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	check((g.capacity() == capacity) && (g.liveVertexCount() == 4096), "churn reuses ids without growing");
+	cout << "  100000 removals and additions on 4096 vertices:  " << (churnSeconds / 100000 * 1e6)
+		<< " us each, capacity unchanged at " << g.capacity() << endl;
+}
+
+int main()
+{
+	testMode(false, false, "an undirected graph matches the model");
+	testMode(true, false, "a directed graph matches the model");
+	testMode(true, true, "a directed graph with the in-edge index matches the model");
+	testVertexCount();
+	cout << "AdjacencyMatrixGraph vertex checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(1500, 12000);
+	return (failures == 0) ? 0 : 1;
+}
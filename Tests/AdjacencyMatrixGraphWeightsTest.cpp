@@ -0,0 +1,243 @@
+/*	AdjacencyMatrixGraphWeightsTest.cpp
+*	Test and benchmark driver for the edge weights of AdjacencyMatrixGraph.  For double, float,
+*	uint16_t and uint8_t storage, random weighted additions and deletions, with and without info
+*	and through the AbstractWeightedGraph interface, are checked against a map:  edgeWeight() must
+*	return the weight given, from both ends of an undirected edge.  loadEdges() must keep the
+*	first weight of a repeated edge, as a CSRGraph does, weights a type cannot hold must throw
+*	before anything changes, and shortest paths over a uint8_t matrix must match a CSRGraph.  The
+*	benchmark runs Dijkstra from every weight type.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <chrono>
+#include <cstdint>
+#include "AdjacencyMatrixGraph.h"
+#include "CSRGraph.h"
+#include "ShortestPaths.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random weight every type can hold exactly:  whole numbers 1 to 200, or odd eighths from -100 to 100 for floating types
+template <class WeightType>
+double randomWeight(unsigned int& seed)
+{
+	if (numeric_limits<WeightType>::is_integer) return 1 + nextRandom(seed) % 200;
+	return (2 * (int)(nextRandom(seed) % 800) - 799) / 8.0;
+}
+
+//a random edge list over n vertices with whole-number weights 1 to 200
+vector<GraphEdge> randomEdges(int n, int m, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(m);
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = 1 + nextRandom(seed) % 200;
+	}
+	return edgeList;
+}
+
+//random weighted changes to a graph of one weight type and direction, checked against a map
+template <class WeightType>
+bool testType(bool directed)
+{
+	const int n = 50;
+	AdjacencyMatrixGraph<int, int, WeightType> g(n, directed);
+	AbstractWeightedGraph<int, int>& weighted = g;
+	map<pair<int, int>, double> model;
+	unsigned int seed = 101 + sizeof(WeightType) + directed;
+	bool ok = true;
+	for (int step = 0; step < 5000; step++)
+	{
+		int a = nextRandom(seed) % n;
+		int b = nextRandom(seed) % n;
+		if (model.count(make_pair(a, b)))
+		{
+			g.deleteEdge(a, b);
+			model.erase(make_pair(a, b));
+			if (!directed) model.erase(make_pair(b, a));
+			continue;
+		}
+		double weight = randomWeight<WeightType>(seed);
+		int info = step;
+		int how = nextRandom(seed) % 3;
+		if (how == 0) g.addEdge(a, b, weight);
+		else if (how == 1) weighted.addEdge(a, b, weight, info);
+		else g.addEdge(a, b, weight, info);
+		model[make_pair(a, b)] = weight;
+		if (!directed) model[make_pair(b, a)] = weight;
+		ok = ok && ((how == 0) || (g.edgeInfo(a, b) == info));
+	}
+	for (int a = 0; a < n; a++)
+		for (int b = 0; b < n; b++)
+		{
+			map<pair<int, int>, double>::iterator m = model.find(make_pair(a, b));
+			ok = ok && (g.hasEdge(a, b) == (m != model.end())) && (g.edgeWeight(a, b) == ((m == model.end()) ? 0.0 : m->second));
+		}
+	return ok;
+}
+
+//the overloads pick weight or info by argument type, and unweighted calls store weight 1
+void testOverloads()
+{
+	AdjacencyMatrixGraph<int, int> g(4);
+	g.addEdge(0, 1);
+	g.addEdge(0, 2, 3);
+	g.addEdge(0, 3, 3.0);
+	int info = 9;
+	g.addEdge(1, 2, 2.5, info);
+	check((g.edgeWeight(1, 0) == 1) && (g.edgeWeight(2, 0) == 1) && (g.edgeInfo(0, 2) == 3),
+		"an integer third argument is edge info, with weight 1");
+	check((g.edgeWeight(3, 0) == 3) && (g.edgeWeight(2, 1) == 2.5) && (g.edgeInfo(2, 1) == 9),
+		"a floating third argument is the weight");
+}
+
+//weights a type cannot hold throw, and a list with one changes nothing
+void testBadWeights()
+{
+	AdjacencyMatrixGraph<int, int, uint8_t> small(4);
+	int threw = 0;
+	try { small.addEdge(0, 1, 256.0); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	try { small.addEdge(0, 1, 0.0); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	try { small.addEdge(0, 1, -2.0); }
+	catch (GraphNegativeEdgeWeight&) { threw++; }
+	try { small.addEdge(0, 1, 1.5); }
+	catch (GraphNonIntegerWeight&) { threw++; }
+	check((threw == 4) && (small.edgeCount() == 0), "uint8_t refuses 256, 0, negative and fractional weights");
+
+	AdjacencyMatrixGraph<int, int, float> single(4, true);
+	AdjacencyMatrixGraph<int, int> full(4);
+	threw = 0;
+	try { single.addEdge(0, 1, 1e-60); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	try { single.addEdge(0, 1, 1e60); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	try { full.addEdge(0, 1, 0.0); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	single.addEdge(2, 3, -0.5);
+	check((threw == 3) && (single.edgeWeight(2, 3) == -0.5f) && (single.edgeCount() == 1),
+		"floating types refuse weights that round to 0 or overflow and keep negative ones");
+
+	vector<GraphEdge> edgeList;
+	GraphEdge good = { 0, 1, 5.0 }, bad = { 2, 3, 300.0 };
+	edgeList.push_back(good);
+	edgeList.push_back(bad);
+	threw = 0;
+	try { small.loadEdges(edgeList); }
+	catch (GraphBadEdgeWeight&) { threw++; }
+	check((threw == 1) && (small.edgeCount() == 0), "loadEdges() checks every weight before adding any edge");
+}
+
+//weighted edge lists and shortest paths against CSRGraph
+void testAgainstCSR()
+{
+	const int n = 300;
+	bool same = true, paths = true;
+	for (int directed = 0; directed < 2; directed++)
+	{
+		vector<GraphEdge> edgeList = randomEdges(n, 3000, 107 + directed);
+		CSRGraph<int, int> csr(n, edgeList, directed == 1);
+		AdjacencyMatrixGraph<int, int, uint8_t> matrix(n, directed == 1);
+		int added = matrix.loadEdges(edgeList);
+		same = same && (added == csr.edgeCount()) && (matrix.edgeCount() == csr.edgeCount());
+		for (int v = 0; v < n; v++)
+		{
+			vector<int> nbors = csr.neighbors(v);
+			same = same && (matrix.neighbors(v) == nbors);
+			for (unsigned int i = 0; i < nbors.size(); i++)
+				same = same && (matrix.edgeWeight(v, nbors[i]) == csr.edgeWeight(v, nbors[i]));
+		}
+		ShortestPaths fromCSR(csr), fromMatrix(matrix);
+		vector<double> dist[2];
+		vector<int> parent[2];
+		for (int source = 0; source < n; source += 37)
+		{
+			fromCSR.singleSource(source, dist[0], parent[0]);
+			fromMatrix.singleSource(source, dist[1], parent[1]);
+			paths = paths && (dist[0] == dist[1]);
+		}
+	}
+	check(same, "loadEdges() keeps the first weight of a repeated edge, as CSRGraph does");
+	check(paths, "shortest paths over a uint8_t matrix match CSRGraph");
+}
+
+//snapshot and Dijkstra from every source block over one weight type
+template <class WeightType>
+void benchmarkType(int n, const vector<GraphEdge>& edgeList, const char* name, double& reference)
+{
+	AdjacencyMatrixGraph<int, int, WeightType> g(n);
+	g.loadEdges(edgeList);
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	ShortestPaths paths(g);
+	double snapshotSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	vector<double> dist;
+	vector<int> parent;
+	double sum = 0;
+	started = chrono::steady_clock::now();
+	for (int source = 0; source < n; source += n / 16)
+	{
+		paths.singleSource(source, dist, parent);
+		for (int v = 0; v < n; v++)
+			sum += dist[v];
+	}
+	double searchSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	if (reference < 0) reference = sum;
+	check(sum == reference, "benchmark distances agree");
+	cout << "  " << name << ":  matrix " << ((double)g.edges.size() * g.edges.stride() * sizeof(WeightType) / 1048576)
+		<< " MB, snapshot " << (snapshotSeconds * 1e3) << " ms, 16 searches " << (searchSeconds * 1e3) << " ms" << endl;
+}
+
+//the same weighted graph stored in every weight type
+void benchmark(int n, int m)
+{
+	vector<GraphEdge> edgeList = randomEdges(n, m, 109);
+	cout << "  " << n << " vertices, " << m << " edges with weights 1 to 200:" << endl;
+	double reference = -1;
+	benchmarkType<double>(n, edgeList, "  double", reference);
+	benchmarkType<float>(n, edgeList, "  float", reference);
+	benchmarkType<uint16_t>(n, edgeList, "  uint16_t", reference);
+	benchmarkType<uint8_t>(n, edgeList, "  uint8_t", reference);
+}
+
+int main()
+{
+	check(testType<double>(false) && testType<double>(true), "double weights match the model");
+	check(testType<float>(false) && testType<float>(true), "float weights match the model");
+	check(testType<uint16_t>(false) && testType<uint16_t>(true), "uint16_t weights match the model");
+	check(testType<uint8_t>(false) && testType<uint8_t>(true), "uint8_t weights match the model");
+	testOverloads();
+	testBadWeights();
+	testAgainstCSR();
+	cout << "AdjacencyMatrixGraph weight checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (Dijkstra over each weight type):" << endl;
+	benchmark(6000, 200000);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+/*	AggregateBinarySearchTreeTest.cpp
+*	Test and benchmark driver for AggregateBinarySearchTree.  Random inserts and removes are
+*	checked against std::set, and after every batch the sum, min and max of random ranges and
+*	prefixes are compared with the same aggregates computed by walking the set.  Keys inserted
+*	and removed in sorted order must keep the height logarithmic and the aggregates right, and
+*	a BinarySearchTree of a key type without operator<< must compile.  The benchmark times range
+*	sums answered from the stored aggregates against summing the range in a std::set.
+*	Build with the repository root on the include path.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <set>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include "AggregateBinarySearchTree.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//sum, min and max of the elements of reference from low to high inclusive
+void referenceAggregates(const set<long long>& reference, long long low, long long high,
+	long long& sum, long long& smallest, long long& largest)
+{
+	sum = 0;
+	smallest = numeric_limits<long long>::max();
+	largest = numeric_limits<long long>::lowest();
+	for (set<long long>::const_iterator i = reference.lower_bound(low); (i != reference.end()) && (*i <= high); ++i)
+	{
+		sum += *i;
+		smallest = min(smallest, *i);
+		largest = max(largest, *i);
+	}
+}
+
+//random updates, with range and prefix aggregates checked after every batch
+void testAgainstSet()
+{
+	const int range = 5000;
+	AggregateBinarySearchTree<long long, SumMonoid<long long>> sums;
+	AggregateBinarySearchTree<long long, MinMonoid<long long>> mins;
+	AggregateBinarySearchTree<long long, MaxMonoid<long long>> maxes;
+	set<long long> reference;
+	unsigned int seed = 9;
+	for (int batch = 0; batch < 40; batch++)
+	{
+		for (int i = 0; i < 500; i++)
+		{
+			long long key = nextRandom(seed) % range;
+			if (nextRandom(seed) % 3 == 0)
+			{
+				bool removed = true;
+				try { sums.remove(key); }
+				catch (BinarySearchTreeNotFound&) { removed = false; }
+				check(removed == (reference.erase(key) == 1), "remove reports whether the key was present");
+				if (removed)
+				{
+					mins.remove(key);
+					maxes.remove(key);
+				}
+			}
+			else if (reference.insert(key).second)
+			{
+				sums.insert(key);
+				mins.insert(key);
+				maxes.insert(key);
+			}
+		}
+		bool ok = (sums.Size() == (int)reference.size());
+		for (int q = 0; q < 200; q++)
+		{
+			long long a = nextRandom(seed) % range;
+			long long b = nextRandom(seed) % range;
+			long long low = min(a, b), high = max(a, b);
+			long long sum, smallest, largest;
+			referenceAggregates(reference, low, high, sum, smallest, largest);
+			ok = ok && (sums.rangeAggregate(low, high) == sum);
+			ok = ok && (mins.rangeAggregate(low, high) == smallest);
+			ok = ok && (maxes.rangeAggregate(low, high) == largest);
+			referenceAggregates(reference, LLONG_MIN, high, sum, smallest, largest);
+			ok = ok && (sums.prefixAggregate(high) == sum);
+		}
+		long long total, smallest, largest;
+		referenceAggregates(reference, LLONG_MIN, LLONG_MAX, total, smallest, largest);
+		ok = ok && (sums.aggregate() == total) && (mins.aggregate() == smallest) && (maxes.aggregate() == largest);
+		check(ok, "aggregates match the ones computed from std::set");
+	}
+}
+
+//ascending and descending runs of keys, which would make an unbalanced tree a list
+void testSortedInserts()
+{
+	const long long n = 100000;
+	int bound = 4 * (int)ceil(log2((double)n));
+	AggregateBinarySearchTree<long long, SumMonoid<long long>> sums;
+	AggregateBinarySearchTree<long long, MinMonoid<long long>> mins;
+	for (long long key = 0; key < n; key++)
+	{
+		sums.insert(key);
+		mins.insert(n - 1 - key);
+	}
+	check((sums.Size() == n) && (sums.Height() <= bound) && (mins.Height() <= bound),
+		"sorted inserts keep the height logarithmic");
+	check((sums.aggregate() == n * (n - 1) / 2) && (sums.rangeAggregate(10, 19) == 145) && (mins.rangeAggregate(500, n) == 500),
+		"aggregates are right after sorted inserts");
+
+	for (long long key = 0; key < n / 2; key++)
+	{
+		sums.remove(key);
+		mins.remove(key);
+	}
+	long long half = n / 2;
+	check((sums.Size() == n - half) && (sums.Height() <= bound) && (mins.Height() <= bound),
+		"sorted removes keep the height logarithmic");
+	check((sums.aggregate() == n * (n - 1) / 2 - half * (half - 1) / 2) && (mins.aggregate() == half)
+		&& (sums.prefixAggregate(half) == half), "aggregates are right after sorted removes");
+}
+
+//a key with comparisons but no operator<<, which the display methods would need
+struct UnprintableKey
+{
+	int value;
+	bool operator<(const UnprintableKey& k) const { return value < k.value; }
+	bool operator>(const UnprintableKey& k) const { return value > k.value; }
+};
+
+//a BinarySearchTree of a key that cannot be printed compiles and works
+void testUnprintableKey()
+{
+	BinarySearchTree<UnprintableKey> tree;
+	for (int i = 0; i < 10; i++)
+	{
+		UnprintableKey key = { (i * 7) % 10 };
+		tree.insert(key);
+	}
+	UnprintableKey probe = { 4 };
+	check((tree.Size() == 10) && tree.contains(probe), "a key type without operator<< works in a BinarySearchTree");
+}
+
+//range sums from the stored aggregates against walking the range of a std::set
+void benchmark(int n, int queries)
+{
+	AggregateBinarySearchTree<long long, SumMonoid<long long>> tree;
+	set<long long> reference;
+	unsigned int seed = 21;
+	while ((int)reference.size() < n)
+	{
+		long long key = nextRandom(seed) % (4LL * n);
+		if (reference.insert(key).second) tree.insert(key);
+	}
+	long long treeTotal = 0, setTotal = 0;
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	unsigned int querySeed = 5;
+	for (int q = 0; q < queries; q++)
+	{
+		long long low = nextRandom(querySeed) % (2LL * n);
+		treeTotal += tree.rangeAggregate(low, low + 2LL * n);
+	}
+	double treeSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	started = chrono::steady_clock::now();
+	querySeed = 5;
+	for (int q = 0; q < queries; q++)
+	{
+		long long low = nextRandom(querySeed) % (2LL * n);
+		for (set<long long>::iterator i = reference.lower_bound(low); (i != reference.end()) && (*i <= low + 2LL * n); ++i)
+			setTotal += *i;
+	}
+	double setSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	check(treeTotal == setTotal, "benchmark sums agree");
+	cout << "  " << n << " keys, ranges of half the keys:  aggregate tree " << (treeSeconds / queries * 1e6)
+		<< " us, std::set walk " << (setSeconds / queries * 1e6) << " us per query" << endl;
+}
+
+int main()
+{
+	testAgainstSet();
+	testSortedInserts();
+	testUnprintableKey();
+	cout << "AggregateBinarySearchTree checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (range sums):" << endl;
+	benchmark(100000, 1000);
+	return (failures == 0) ? 0 : 1;
+}
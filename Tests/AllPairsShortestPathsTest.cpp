@@ -0,0 +1,181 @@
+/*	AllPairsShortestPathsTest.cpp
+*	Test and benchmark driver for AllPairsShortestPaths.  Distances on random directed graphs,
+*	some with negative weights, are checked against a plain triple-loop Floyd-Warshall for
+*	vertex counts that are and are not multiples of the tile size, and with one and several
+*	threads.  Every rebuilt path must add up to its distance, a negative cycle must be
+*	reported, and nextHop() must refuse when next hops were not kept.  The benchmark compares
+*	the blocked solver with the triple loop on a dense graph.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <cmath>
+#include "CSRGraph.h"
+#include "AllPairsShortestPaths.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random directed graph without parallel edges; weights lie in [low, low + 20).  When low is
+//negative every edge runs from a lower to a higher vertex, so there is no negative cycle.
+CSRGraph<int, int> randomGraph(int n, int edges, int low, unsigned int seed)
+{
+	vector<GraphEdge> edgeList;
+	set<pair<int, int>> used;
+	for (int i = 0; i < edges; i++)
+	{
+		GraphEdge e;
+		e.start = nextRandom(seed) % n;
+		e.end = nextRandom(seed) % n;
+		if ((low < 0) && (e.start >= e.end))
+		{
+			if (e.start == e.end) continue;
+			swap(e.start, e.end);
+		}
+		if (!used.insert(make_pair(e.start, e.end)).second) continue;
+		e.weight = low + (int)(nextRandom(seed) % 20);
+		edgeList.push_back(e);
+	}
+	return CSRGraph<int, int>(n, edgeList, true);
+}
+
+//the plain triple loop over a full matrix
+vector<double> floydWarshall(CSRGraph<int, int>& g)
+{
+	int n = g.vertexCount();
+	vector<double> d((size_t)n * n, numeric_limits<double>::infinity());
+	for (int v = 0; v < n; v++)
+	{
+		for (const int* w = g.neighborBegin(v); w < g.neighborEnd(v); w++)
+			d[(size_t)v * n + *w] = g.edgeWeight(v, *w);
+		if (d[(size_t)v * n + v] > 0) d[(size_t)v * n + v] = 0;
+	}
+	for (int k = 0; k < n; k++)
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < n; j++)
+				if (d[(size_t)i * n + k] + d[(size_t)k * n + j] < d[(size_t)i * n + j])
+					d[(size_t)i * n + j] = d[(size_t)i * n + k] + d[(size_t)k * n + j];
+	return d;
+}
+
+//distances and paths against the triple loop
+void testAgainstFloydWarshall(int n, int edges, int low, int threads)
+{
+	CSRGraph<int, int> g = randomGraph(n, edges, low, 7 + n);
+	vector<double> expected = floydWarshall(g);
+	ThreadPool pool(threads);
+	AllPairsShortestPaths apsp(g, pool, true);
+	check(apsp.vertexCount() == n, "vertexCount()");
+	check(!apsp.hasNegativeCycle(), "no negative cycle is reported without one");
+
+	bool distances = true;
+	bool paths = true;
+	for (int i = 0; i < n; i++)
+	{
+		const double* row = apsp.distanceRow(i);
+		for (int j = 0; j < n; j++)
+		{
+			double d = expected[(size_t)i * n + j];
+			distances = distances && (apsp.distance(i, j) == d) && (row[j] == d);
+			vector<int> p;
+			apsp.path(i, j, p);
+			if (std::isinf(d))
+			{
+				paths = paths && p.empty() && (apsp.nextHop(i, j) == -1);
+				continue;
+			}
+			double sum = 0;
+			bool valid = !p.empty() && (p.front() == i) && (p.back() == j);
+			for (unsigned int k = 1; valid && k < p.size(); k++)
+			{
+				valid = g.hasEdge(p[k - 1], p[k]);
+				if (valid) sum += g.edgeWeight(p[k - 1], p[k]);
+			}
+			paths = paths && valid && (sum == d);
+		}
+	}
+	check(distances, "distances match the triple loop");
+	check(paths, "every path adds up to its distance");
+}
+
+//a negative cycle, and the refusals
+void testNegativeCycleAndErrors()
+{
+	vector<GraphEdge> edgeList(3);
+	edgeList[0].start = 0; edgeList[0].end = 1; edgeList[0].weight = 1;
+	edgeList[1].start = 1; edgeList[1].end = 2; edgeList[1].weight = -3;
+	edgeList[2].start = 2; edgeList[2].end = 0; edgeList[2].weight = 1;
+	CSRGraph<int, int> g(4, edgeList, true);
+	ThreadPool pool(2);
+	AllPairsShortestPaths apsp(g, pool);
+	check(apsp.hasNegativeCycle(), "a negative cycle is reported");
+	check(std::isinf(apsp.distance(0, 3)), "an unreachable vertex is at infinity");
+
+	bool threw = false;
+	try { apsp.nextHop(0, 1); }
+	catch (GraphNextHopsNotKept&) { threw = true; }
+	check(threw, "nextHop() without kept next hops throws");
+	threw = false;
+	try { apsp.distance(0, 4); }
+	catch (GraphVertexOutOfBounds&) { threw = true; }
+	check(threw, "distance() to a vertex out of range throws");
+}
+
+//the blocked solver against the triple loop on a dense graph
+void benchmark(int n, int threads)
+{
+	CSRGraph<int, int> g = randomGraph(n, n * n / 4, 1, 3);
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	vector<double> expected = floydWarshall(g);
+	double plainSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+	ThreadPool pool(threads);
+	started = chrono::steady_clock::now();
+	AllPairsShortestPaths apsp(g, pool);
+	double blockedSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+	bool same = true;
+	for (int i = 0; i < n; i++)
+		for (int j = 0; j < n; j++)
+			same = same && (apsp.distance(i, j) == expected[(size_t)i * n + j]);
+	check(same, "benchmark solvers agree");
+	cout << "  " << n << " vertices, " << pool.threadCount() << " threads:  triple loop " << (plainSeconds * 1e3)
+		<< " ms, blocked " << (blockedSeconds * 1e3) << " ms" << endl;
+}
+
+int main()
+{
+	testAgainstFloydWarshall(64, 600, 1, 1);
+	testAgainstFloydWarshall(150, 1500, 1, 4);
+	testAgainstFloydWarshall(200, 3000, -2, 3);
+	testNegativeCycleAndErrors();
+	cout << "AllPairsShortestPaths checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(1000, 1);
+	benchmark(1000, 4);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+/*	BinarySearchTreeAdaptiveTest.cpp
+*	Test and benchmark driver for the adaptive (splaying) mode of BinarySearchTree.  Random
+*	inserts, removes, contains(), find() and findPtr() calls are checked against std::set with
+*	splaying on and off:  the inorder contents and Size() must match after every batch, a lookup
+*	must bring a key it finds to the root, and turning the mode off must leave a plain tree.  The
+*	benchmark runs a Zipf-distributed lookup stream against a static and an adaptive tree and
+*	reports the average search depth and lookups per second of each.
+*	Build with the repository root on the include path.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cmath>
+#include <chrono>
+#include <algorithm>
+#include "BinarySearchTree.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//true if the tree holds exactly the keys of reference, in order
+bool sameContents(BinarySearchTree<int>& tree, const set<int>& reference)
+{
+	vector<int> sorted;
+	tree.toSortedVector(sorted);
+	return (tree.Size() == (int)reference.size()) && (sorted == vector<int>(reference.begin(), reference.end()));
+}
+
+//random operations against std::set, with or without splaying
+void testAgainstSet(bool adaptive, const char* what)
+{
+	const int range = 3000;
+	BinarySearchTree<int> tree;
+	tree.setAdaptive(adaptive);
+	set<int> reference;
+	unsigned int seed = adaptive ? 31 : 37;
+	bool ok = true, splayed = true;
+	for (int step = 0; step < 60000; step++)
+	{
+		int key = nextRandom(seed) % range;
+		int op = nextRandom(seed) % 6;
+		bool present = (reference.count(key) == 1);
+		if (op == 0)
+		{
+			tree.insert(key);
+			reference.insert(key);
+		}
+		else if (op == 1)
+		{
+			ok = ok && (tree.tryInsert(key) == !present);
+			reference.insert(key);
+		}
+		else if (op == 2)
+		{
+			bool removed = true;
+			try { tree.remove(key); }
+			catch (BinarySearchTreeNotFound&) { removed = false; }
+			ok = ok && (removed == present);
+			reference.erase(key);
+		}
+		else if (op == 3)
+			ok = ok && (tree.contains(key) == present);
+		else if (op == 4)
+		{
+			int* found = tree.findPtr(key);
+			ok = ok && ((found != NULL) == present) && ((found == NULL) || (*found == key));
+		}
+		else
+		{
+			bool threw = false;
+			try { ok = ok && (tree.find(key) == key); }
+			catch (BinarySearchTreeNotFound&) { threw = true; }
+			ok = ok && (threw == !present);
+		}
+		if (adaptive && present && (op >= 3))
+			splayed = splayed && (tree.rootData() == key) && (tree.depth(key) == 1);
+		if (step % 1000 == 999) ok = ok && sameContents(tree, reference);
+	}
+	check(ok && sameContents(tree, reference), what);
+	if (adaptive) check(splayed, "a lookup that finds its key splays it to the root");
+
+	tree.setAdaptive(false);
+	int root = tree.rootData();
+	int other = *reference.rbegin();
+	if (other == root) other = *reference.begin();
+	check(tree.contains(other) && (tree.rootData() == root) && sameContents(tree, reference),
+		"with splaying off a lookup leaves the shape alone");
+}
+
+//ascending inserts in adaptive mode, then lookups of every key
+void testSortedAdaptive()
+{
+	const int n = 5000;
+	BinarySearchTree<int> tree;
+	tree.setAdaptive(true);
+	set<int> reference;
+	for (int key = 0; key < n; key++)
+	{
+		tree.insert(key);
+		reference.insert(key);
+	}
+	bool found = true;
+	for (int key = 0; key < n; key += 3)
+		found = found && (tree.findPtr(key) != NULL) && (*tree.findPtr(key) == key);
+	check(found && (tree.findPtr(n) == NULL) && sameContents(tree, reference), "sorted inserts in adaptive mode keep every key");
+
+	bool threw = false;
+	try { tree.left()->setAdaptive(false); }
+	catch (BinarySearchTreeChangedSubtree&) { threw = true; }
+	check(threw, "a subtree cannot change the mode");
+}
+
+//Zipf ranks 0 .. n-1 with exponent s, drawn by searching a precomputed distribution
+class ZipfGenerator
+{
+protected:
+	vector<double> _cumulative;
+	unsigned int _seed;
+
+public:
+	ZipfGenerator(int n, double s, unsigned int seed)
+	{
+		_cumulative.resize(n);
+		double total = 0;
+		for (int i = 0; i < n; i++)
+		{
+			total += 1.0 / pow(i + 1.0, s);
+			_cumulative[i] = total;
+		}
+		for (int i = 0; i < n; i++)
+			_cumulative[i] /= total;
+		_seed = seed;
+	}
+	int next()
+	{
+		double u = (nextRandom(_seed) + 0.5) / 4294967296.0;
+		return (int)(lower_bound(_cumulative.begin(), _cumulative.end(), u) - _cumulative.begin());
+	}
+};
+
+//lookups from a Zipf stream on a static and an adaptive tree holding the same keys
+void benchmark(int n, int lookups, double s)
+{
+	vector<int> keys(n);
+	for (int i = 0; i < n; i++)
+		keys[i] = 2 * i;
+	unsigned int seed = 41;
+	for (int i = n - 1; i > 0; i--)
+		swap(keys[i], keys[nextRandom(seed) % (i + 1)]);
+
+	vector<int> byRank(keys);									//a second order, so that popularity
+	for (int i = n - 1; i > 0; i--)								//does not follow insertion order
+		swap(byRank[i], byRank[nextRandom(seed) % (i + 1)]);
+	ZipfGenerator zipf(n, s, 43);
+	vector<int> queries(lookups);
+	for (int i = 0; i < lookups; i++)
+		queries[i] = byRank[zipf.next()];
+
+	cout << "  " << n << " keys, " << lookups << " lookups, Zipf s = " << s << ":" << endl;
+	long long hits[2] = { 0, 0 };
+	for (int adaptive = 0; adaptive < 2; adaptive++)
+	{
+		BinarySearchTree<int> tree;
+		for (int i = 0; i < n; i++)
+			tree.insert(keys[i]);
+		tree.setAdaptive(adaptive == 1);
+
+		long long depthSum = 0;
+		int sampled = 0;
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < lookups; i++)
+			hits[adaptive] += (tree.findPtr(queries[i]) != NULL);
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+		for (int i = 0; i < lookups; i++)						//the stream again, sampling depths
+		{
+			if (i % 10 == 0)
+			{
+				depthSum += tree.depth(queries[i]);
+				sampled++;
+			}
+			tree.findPtr(queries[i]);
+		}
+		cout << "    " << (adaptive ? "adaptive" : "static") << ":  average depth " << ((double)depthSum / sampled)
+			<< ", " << (lookups / seconds / 1e6) << " M lookups/s" << endl;
+	}
+	check((hits[0] == lookups) && (hits[1] == lookups), "benchmark lookups all hit");
+}
+
+int main()
+{
+	testAgainstSet(false, "a static tree matches std::set");
+	testAgainstSet(true, "an adaptive tree matches std::set");
+	testSortedAdaptive();
+	cout << "BinarySearchTree adaptive checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (Zipf lookups):" << endl;
+	benchmark(200000, 2000000, 1.0);
+	benchmark(200000, 2000000, 1.2);
+	return (failures == 0) ? 0 : 1;
+}
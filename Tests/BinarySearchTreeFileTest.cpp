@@ -0,0 +1,300 @@
+/*	BinarySearchTreeFileTest.cpp
+*	Test and benchmark driver for BinarySearchTreeFile and MappedBinarySearchTree.  Trees of
+*	int, negative long long and double keys are saved raw and delta encoded, loaded back and
+*	compared; the raw files are also searched in place.  A delta-encoded save of double keys
+*	must fail without touching the existing file, a save must replace the old file whole and
+*	leave no temporary file behind, and files with a damaged count or keys out of order must be
+*	rejected.  The benchmark compares loading a checkpoint with rebuilding the tree by inserts
+*	and times lookups in the mapped file; its key count is the first argument (default 1000000,
+*	and 268435456 int keys make a 1 GB raw file).
+*	Build with the repository root on the include path.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "BinarySearchTreeFile.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//returns the keys of a tree in order
+template <class DataType>
+vector<DataType> contents(BinarySearchTree<DataType>& bst)
+{
+	vector<DataType> keys;
+	bst.toSortedVector(keys);
+	return keys;
+}
+
+//returns the bytes of a file
+vector<char> fileBytes(const char* filename)
+{
+	ifstream in(filename, ios::binary);
+	return vector<char>((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+}
+
+//saves a tree both ways, loads it back, and searches the raw file in place
+template <class DataType>
+void testRoundTrip(const vector<DataType>& values, bool delta, const char* what)
+{
+	const char* filename = "bstfile_test.bin";
+	BinarySearchTree<DataType> tree;
+	for (unsigned int i = 0; i < values.size(); i++)
+		tree.insert(values[i]);
+	vector<DataType> expected = contents(tree);
+
+	BinarySearchTreeFile<DataType>::save(tree, filename, delta);
+	BinarySearchTree<DataType> loaded;
+	BinarySearchTreeFile<DataType>::load(loaded, filename);
+	check(contents(loaded) == expected, what);
+	if (!delta)
+	{
+		MappedBinarySearchTree<DataType> mapped(filename);
+		bool ok = (mapped.Size() == (int)expected.size());
+		for (unsigned int i = 0; i < expected.size(); i++)
+			ok = ok && mapped.contains(expected[i]) && (*mapped.lowerBound(expected[i]) == expected[i]);
+		check(ok, "mapped search finds every key");
+	}
+	remove(filename);
+}
+
+//a save that cannot be written must leave the previous checkpoint intact
+void testRefusedSave()
+{
+	const char* filename = "bstfile_test.bin";
+	BinarySearchTree<double> tree;
+	tree.insert(1.5);
+	tree.insert(2.5);
+	BinarySearchTreeFile<double>::save(tree, filename);
+	vector<char> before = fileBytes(filename);
+	tree.insert(3.5);
+	bool threw = false;
+	try { BinarySearchTreeFile<double>::save(tree, filename, true); }
+	catch (BinarySearchTreeFileFormat&) { threw = true; }
+	check(threw, "delta encoding of double keys is refused");
+	check(fileBytes(filename) == before, "a refused save leaves the existing file alone");
+	remove(filename);
+}
+
+//true if filename can be opened
+bool exists(const char* filename)
+{
+	ifstream in(filename, ios::binary);
+	return in.good();
+}
+
+//a save goes through filename.tmp and replaces the old checkpoint only once it is complete
+void testReplacingSave()
+{
+	const char* filename = "bstfile_test.bin";
+	BinarySearchTree<int> tree;
+	for (int i = 0; i < 100; i++)
+		tree.insert(i * 3);
+	BinarySearchTreeFile<int>::save(tree, filename);
+	{
+		ofstream stale("bstfile_test.bin.tmp", ios::binary);
+		stale << "left by a crash";
+	}
+	tree.insert(1000);
+	BinarySearchTreeFile<int>::save(tree, filename, true);
+	BinarySearchTree<int> loaded;
+	BinarySearchTreeFile<int>::load(loaded, filename);
+	check((contents(loaded) == contents(tree)) && !exists("bstfile_test.bin.tmp"),
+		"a save replaces the old file and leaves no temporary file");
+
+	vector<char> before = fileBytes(filename);
+	bool threw = false;
+	try { BinarySearchTreeFile<int>::save(tree, "no_such_directory/bstfile_test.bin"); }
+	catch (BinarySearchTreeFileError&) { threw = true; }
+	check(threw && (fileBytes(filename) == before) && !exists("no_such_directory/bstfile_test.bin.tmp"),
+		"a save that cannot be written throws and creates nothing");
+	remove(filename);
+}
+
+//writes int keys in the given order, raw or delta encoded, and expects load() to reject them
+void testUnsortedKeys(const vector<int>& keys, bool delta, const char* what)
+{
+	const char* filename = "bstfile_test.bin";
+	BinarySearchTreeFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "BSTF", 4);
+	header.version = BST_FILE_VERSION;
+	header.flags = delta ? BST_FILE_DELTA : 0;
+	header.keySize = sizeof(int);
+	header.count = keys.size();
+	{
+		ofstream out(filename, ios::binary);
+		out.write((const char*)&header, sizeof(header));
+		uint64_t previous = 0;
+		for (unsigned int i = 0; i < keys.size(); i++)
+		{
+			if (!delta)
+			{
+				out.write((const char*)&keys[i], sizeof(int));
+				continue;
+			}
+			uint64_t difference = (uint64_t)(long long)keys[i] - previous;
+			previous = (uint64_t)(long long)keys[i];
+			while (difference >= 0x80)
+			{
+				out.put((char)(difference | 0x80));
+				difference >>= 7;
+			}
+			out.put((char)difference);
+		}
+	}
+	BinarySearchTree<int> tree;
+	tree.insert(42);
+	bool rejected = false;
+	try { BinarySearchTreeFile<int>::load(tree, filename); }
+	catch (BinarySearchTreeFileFormat&) { rejected = true; }
+	check(rejected && (contents(tree) == vector<int>(1, 42)), what);
+	remove(filename);
+}
+
+//writes a header with the given count and some key bytes, and expects every reader to reject it
+void testDamagedCount(uint64_t count, uint32_t flags, const char* what)
+{
+	const char* filename = "bstfile_test.bin";
+	BinarySearchTreeFileHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, "BSTF", 4);
+	header.version = BST_FILE_VERSION;
+	header.flags = flags;
+	header.keySize = sizeof(int);
+	header.count = count;
+	{
+		ofstream out(filename, ios::binary);
+		out.write((const char*)&header, sizeof(header));
+		int keys[4] = { 1, 2, 3, 4 };
+		out.write((const char*)keys, sizeof(keys));
+	}
+	bool loadRejected = false;
+	try
+	{
+		BinarySearchTree<int> tree;
+		BinarySearchTreeFile<int>::load(tree, filename);
+	}
+	catch (BinarySearchTreeFileFormat&) { loadRejected = true; }
+	bool mapRejected = false;
+	try { MappedBinarySearchTree<int> mapped(filename); }
+	catch (BinarySearchTreeFileFormat&) { mapRejected = true; }
+	check(loadRejected && mapRejected, what);
+	remove(filename);
+}
+
+//loading a checkpoint against rebuilding the tree by inserting the keys in random order, and
+//lookups in the mapped raw file.  Only one tree is alive at a time, so n is bounded by the
+//memory of one tree.
+void benchmark(int n)
+{
+	const char* filenames[2] = { "bstfile_bench.bin", "bstfile_bench_delta.bin" };
+	unsigned int seed = 3;
+	int size;
+	double insertSeconds;
+	{
+		BinarySearchTree<int> tree;
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < n; i++)
+			tree.insert((int)(nextRandom(seed) >> 1));
+		insertSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+		size = tree.Size();
+		chrono::steady_clock::time_point saving = chrono::steady_clock::now();
+		BinarySearchTreeFile<int>::save(tree, filenames[0]);
+		cout << "  " << n << " random inserts, " << size << " keys:  inserts " << (insertSeconds * 1e3) << " ms, raw save "
+			<< (chrono::duration<double>(chrono::steady_clock::now() - saving).count() * 1e3) << " ms" << endl;
+		BinarySearchTreeFile<int>::save(tree, filenames[1], true);
+	}
+
+	for (int delta = 0; delta < 2; delta++)
+	{
+		ifstream in(filenames[delta], ios::binary | ios::ate);
+		long long bytes = (long long)in.tellg();
+		BinarySearchTree<int> loaded;
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		BinarySearchTreeFile<int>::load(loaded, filenames[delta]);
+		double loadSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+		cout << "  " << (delta ? "delta" : "raw") << " file of " << bytes << " bytes:  load " << (loadSeconds * 1e3)
+			<< " ms, " << (insertSeconds / loadSeconds) << " times faster than inserts" << endl;
+		check(loaded.Size() == size, "benchmark load keeps every key");
+	}
+
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	MappedBinarySearchTree<int> mapped(filenames[0]);
+	long long hits = 0;
+	const int lookups = min(n, 1000000);
+	seed = 3;
+	for (int i = 0; i < lookups; i++)
+		hits += mapped.contains((int)(nextRandom(seed) >> 1));
+	double mappedSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	check(hits == lookups, "benchmark mapped lookups find the inserted keys");
+	cout << "  mapped raw file:  map and " << lookups << " lookups " << (mappedSeconds * 1e3) << " ms" << endl;
+	remove(filenames[0]);
+	remove(filenames[1]);
+}
+
+int main(int argc, char* argv[])
+{
+	long long n = (argc > 1) ? atoll(argv[1]) : 1000000;
+	if ((n < 1) || (n > INT_MAX))
+	{
+		cout << "usage:  " << argv[0] << " [key count, 1 to " << INT_MAX << "]" << endl;
+		return 2;
+	}
+
+	vector<int> ints;
+	vector<long long> longs;
+	vector<double> doubles;
+	unsigned int seed = 1;
+	for (int i = 0; i < 5000; i++)
+	{
+		ints.push_back((int)(nextRandom(seed) % 100000));
+		longs.push_back(-(long long)nextRandom(seed) * 1000003LL);
+		doubles.push_back(nextRandom(seed) / 7.0);
+	}
+	testRoundTrip(ints, false, "raw int keys round trip");
+	testRoundTrip(ints, true, "delta int keys round trip");
+	testRoundTrip(longs, true, "delta negative long long keys round trip");
+	testRoundTrip(doubles, false, "raw double keys round trip");
+	testRoundTrip(vector<int>(), true, "an empty tree round trips");
+	testRefusedSave();
+	testReplacingSave();
+	int descending[] = { 1, 5, 3 }, repeated[] = { 1, 4, 4, 9 }, wrapped[] = { -5, 7, 2000000000, -2000000000 };
+	testUnsortedKeys(vector<int>(descending, descending + 3), false, "raw keys out of order are rejected");
+	testUnsortedKeys(vector<int>(repeated, repeated + 4), false, "raw repeated keys are rejected");
+	testUnsortedKeys(vector<int>(repeated, repeated + 4), true, "a zero delta is rejected");
+	testUnsortedKeys(vector<int>(wrapped, wrapped + 4), true, "a delta that wraps past the largest key is rejected");
+	testDamagedCount(5, 0, "raw count past the end of the file is rejected");
+	testDamagedCount((uint64_t)1 << 62, 0, "raw count that overflows a byte size is rejected");
+	testDamagedCount((uint64_t)INT_MAX + 1, 0, "raw count beyond int is rejected");
+	testDamagedCount(1000, BST_FILE_DELTA, "delta count past the end of the file is rejected");
+	cout << "BinarySearchTreeFile checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark((int)n);
+	return (failures == 0) ? 0 : 1;
+}
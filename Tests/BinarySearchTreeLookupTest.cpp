@@ -0,0 +1,172 @@
+/*	BinarySearchTreeLookupTest.cpp
+*	Test and benchmark driver for findPtr(), tryInsert(), insertOrAssign() and emplace() of
+*	BinarySearchTree, with splaying off and on.  A miss must return NULL without throwing,
+*	insertOrAssign() of a present key must assign in place so the data keeps its address, and
+*	tryInsert() or emplace() of a present key must return false and leave the value alone.
+*	emplace() must build a new element without copying it.  The benchmark counts keys with
+*	find() and insert() against findPtr() and emplace().
+*	Build with the repository root on the include path.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <chrono>
+#include "BinarySearchTree.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//an element ordered by key alone, with a payload and a count of the copies made of any entry
+struct Entry
+{
+	static int copies;
+	int key;
+	int value;
+	string payload;
+
+	Entry(int k = 0, int v = 0) : key(k), value(v), payload(48, 'x') { }
+	Entry(const Entry& e) : key(e.key), value(e.value), payload(e.payload) { copies++; }
+	Entry& operator=(const Entry& e)
+	{
+		key = e.key;
+		value = e.value;
+		payload = e.payload;
+		copies++;
+		return *this;
+	}
+	bool operator<(const Entry& e) const { return key < e.key; }
+	bool operator>(const Entry& e) const { return key > e.key; }
+};
+
+int Entry::copies = 0;
+
+//the lookup and insert checks on one tree mode
+void testMode(bool adaptive, const char* what)
+{
+	BinarySearchTree<Entry> tree;
+	tree.setAdaptive(adaptive);
+	bool ok = (tree.findPtr(Entry(5)) == NULL);
+	unsigned int seed = adaptive ? 53 : 59;
+	for (int i = 0; i < 500; i++)
+	{
+		int key = 2 * (int)(nextRandom(seed) % 1000);
+		if (tree.findPtr(Entry(key)) == NULL) ok = ok && tree.emplace(key, key);
+	}
+
+	bool missed = true;
+	try
+	{
+		for (int key = -1; key < 2001; key += 2)
+			missed = missed && (tree.findPtr(Entry(key)) == NULL);
+	}
+	catch (BinarySearchTreeNotFound&) { missed = false; }
+	check(ok && missed, (string(what) + ":  a miss returns NULL without throwing").c_str());
+
+	int size = tree.Size();
+	bool inPlace = true, unchanged = true;
+	for (int round = 0; round < 200; round++)
+	{
+		int key = 2 * (int)(nextRandom(seed) % 1000);
+		Entry* before = tree.findPtr(Entry(key));
+		if (before == NULL) continue;
+		int value = before->value;
+		unchanged = unchanged && !tree.tryInsert(Entry(key, -1)) && (tree.findPtr(Entry(key))->value == value);
+		unchanged = unchanged && !tree.emplace(key, -2) && (tree.findPtr(Entry(key))->value == value);
+		inPlace = inPlace && !tree.insertOrAssign(Entry(key, value + 1)) && (tree.findPtr(Entry(key)) == before);
+		inPlace = inPlace && (before->value == value + 1) && (before->key == key);
+	}
+	check(unchanged && (tree.Size() == size),
+		(string(what) + ":  tryInsert() and emplace() of a present key change nothing").c_str());
+	check(inPlace, (string(what) + ":  insertOrAssign() of a present key assigns in place").c_str());
+
+	int copies = Entry::copies;
+	bool added = tree.emplace(1, 7);
+	Entry* made = tree.findPtr(Entry(1));
+	check(added && (made != NULL) && (made->value == 7) && (Entry::copies == copies),
+		(string(what) + ":  emplace() builds the element without copying it").c_str());
+	Entry::copies = 0;
+	check(tree.insertOrAssign(Entry(3, 9)) && (tree.findPtr(Entry(3))->value == 9) && (Entry::copies == 1),
+		(string(what) + ":  insertOrAssign() of a new key copies it once").c_str());
+}
+
+//word-count style updates:  increment the value of a key, or add it with 1
+void benchmark(int keys, int updates)
+{
+	cout << "  " << keys << " keys, " << updates << " updates:" << endl;
+	for (int adaptive = 0; adaptive < 2; adaptive++)
+	{
+		BinarySearchTree<Entry> copying, inPlace;
+		copying.setAdaptive(adaptive == 1);
+		inPlace.setAdaptive(adaptive == 1);
+		unsigned int seed = 61;
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < updates; i++)
+		{
+			Entry probe(nextRandom(seed) % keys);
+			if (copying.contains(probe))
+			{
+				Entry e = copying.find(probe);
+				e.value++;
+				copying.insert(e);
+			}
+			else
+			{
+				probe.value = 1;
+				copying.insert(probe);
+			}
+		}
+		double copySeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+		seed = 61;
+		started = chrono::steady_clock::now();
+		for (int i = 0; i < updates; i++)
+		{
+			int key = nextRandom(seed) % keys;
+			Entry* e = inPlace.findPtr(Entry(key));
+			if (e != NULL) e->value++;
+			else inPlace.emplace(key, 1);
+		}
+		double inPlaceSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+		vector<Entry> a, b;
+		copying.toSortedVector(a);
+		inPlace.toSortedVector(b);
+		bool agree = (a.size() == b.size());
+		for (unsigned int i = 0; agree && (i < a.size()); i++)
+			agree = (a[i].key == b[i].key) && (a[i].value == b[i].value);
+		check(agree, "benchmark counts agree");
+		cout << "    " << (adaptive ? "adaptive" : "static") << ":  contains/find/insert " << (updates / copySeconds / 1e6)
+			<< " M/s, findPtr/emplace " << (updates / inPlaceSeconds / 1e6) << " M/s" << endl;
+	}
+}
+
+int main()
+{
+	testMode(false, "static mode");
+	testMode(true, "adaptive mode");
+	cout << "BinarySearchTree lookup checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (counting updates):" << endl;
+	benchmark(50000, 2000000);
+	return (failures == 0) ? 0 : 1;
+}
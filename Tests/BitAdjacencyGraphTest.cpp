@@ -0,0 +1,150 @@
+/*	BitAdjacencyGraphTest.cpp
+*	Test and benchmark driver for BitAdjacencyGraph.  Random edges are added and deleted in a
+*	bit graph and in an undirected AdjacencyMatrixGraph, and the two must agree on every edge,
+*	neighbor list and degree; common neighbor counts are checked against a direct count, and
+*	edge data must be shared by both ends of an edge.  The benchmark times common neighbor
+*	counts against intersecting the matrix rows.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include "AdjacencyMatrixGraph.h"
+#include "BitAdjacencyGraph.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//random additions and deletions mirrored in an adjacency matrix
+void testAgainstMatrix()
+{
+	const int n = 300;
+	BitAdjacencyGraph<int, int> bits(n);
+	AdjacencyMatrixGraph<int, int> matrix(n);
+	unsigned int seed = 13;
+	for (int i = 0; i < 20000; i++)
+	{
+		int u = nextRandom(seed) % n;
+		int v = nextRandom(seed) % n;
+		if (matrix.hasEdge(u, v))
+		{
+			if (nextRandom(seed) % 2 == 0)
+			{
+				bits.deleteEdge(u, v);
+				matrix.deleteEdge(u, v);
+			}
+		}
+		else
+		{
+			bits.addEdge(u, v);
+			matrix.addEdge(u, v);
+		}
+	}
+	bool ok = (bits.edgeCount() == matrix.edgeCount());
+	for (int v = 0; v < n; v++)
+	{
+		vector<int> nbors = matrix.neighbors(v);
+		ok = ok && (bits.neighbors(v) == nbors) && (bits.degree(v) == (int)nbors.size());
+	}
+	check(ok, "edges, neighbors and degrees match the adjacency matrix");
+
+	ok = true;
+	for (int i = 0; i < 2000; i++)
+	{
+		int u = nextRandom(seed) % n;
+		int v = nextRandom(seed) % n;
+		int common = 0;
+		for (int w = 0; w < n; w++)
+			if (matrix.hasEdge(u, w) && matrix.hasEdge(v, w)) common++;
+		ok = ok && (bits.commonNeighborCount(u, v) == common);
+	}
+	check(ok, "common neighbor counts match a direct count");
+}
+
+//edge data is one entry per edge, seen from both ends
+void testEdgeInfo()
+{
+	BitAdjacencyGraph<int, int> g(70);
+	int info = 5;
+	g.addEdge(3, 66, info);
+	check((g.edgeInfo(66, 3) == 5) && (g.edgeInfo(3, 66) == 5), "edge data is shared by both ends");
+	info = 9;
+	g.setEdgeInfo(66, 3, info);
+	check(g.edgeInfo(3, 66) == 9, "setEdgeInfo() from either end");
+	g.addEdge(4, 5);
+	check(g.edgeInfo(5, 4) == 0, "an edge without data reads the default");
+	g.deleteEdge(66, 3);
+	g.addEdge(3, 66);
+	check(g.edgeInfo(3, 66) == 0, "deleting an edge drops its data");
+}
+
+//common neighbor counts by popcount against intersecting matrix rows
+void benchmark(int n, int degree)
+{
+	BitAdjacencyGraph<int, int> bits(n);
+	AdjacencyMatrixGraph<int, int> matrix(n);
+	unsigned int seed = 31;
+	for (int i = 0; i < n * degree / 2; i++)
+	{
+		int u = nextRandom(seed) % n;
+		int v = nextRandom(seed) % n;
+		if (bits.hasEdge(u, v)) continue;
+		bits.addEdge(u, v);
+		matrix.addEdge(u, v);
+	}
+	const int pairs = 2000;
+	long long totals[2] = { 0, 0 };
+	double seconds[2];
+	for (int method = 0; method < 2; method++)
+	{
+		unsigned int pairSeed = 8;
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < pairs; i++)
+		{
+			int u = nextRandom(pairSeed) % n;
+			int v = nextRandom(pairSeed) % n;
+			if (method == 0) totals[0] += bits.commonNeighborCount(u, v);
+			else
+			{
+				for (int w = 0; w < n; w++)
+					if ((matrix.edges[u][w] != 0) && (matrix.edges[v][w] != 0)) totals[1]++;
+			}
+		}
+		seconds[method] = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	}
+	check(totals[0] == totals[1], "benchmark counts agree");
+	cout << "  " << n << " vertices, degree " << degree << ":  bit rows " << (seconds[0] / pairs * 1e6)
+		<< " us, matrix rows " << (seconds[1] / pairs * 1e6) << " us per common neighbor count" << endl;
+}
+
+int main()
+{
+	testAgainstMatrix();
+	testEdgeInfo();
+	cout << "BitAdjacencyGraph checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (common neighbor counts):" << endl;
+	benchmark(4000, 400);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+/*	CSRGraphTest.cpp
+*	Test and benchmark driver for CSRGraph.  A graph built from an edge list is compared with an
+*	AdjacencyMatrixGraph holding the same edges.  Snapshots of directed and undirected graphs
+*	must keep the direction of their source, so deleting a one-way edge of a directed snapshot
+*	touches only that edge, and setting the info of an undirected edge must be seen from both
+*	ends.  The benchmark times a scan of every neighbor list in both representations.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include "AdjacencyMatrixGraph.h"
+#include "CSRGraph.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random edge list over n vertices, with repeats and self loops
+vector<GraphEdge> randomEdges(int n, int m, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(m);
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = 1.0;
+	}
+	return edgeList;
+}
+
+//true if both graphs have the same vertices, edge count and neighbor lists
+template <class GraphA, class GraphB>
+bool sameGraph(GraphA& a, GraphB& b)
+{
+	if ((a.vertexCount() != b.vertexCount()) || (a.edgeCount() != b.edgeCount())) return false;
+	for (int v = 0; v < a.vertexCount(); v++)
+		if (a.neighbors(v) != b.neighbors(v)) return false;
+	return true;
+}
+
+//edge-list builds against the adjacency matrix, both directed and undirected
+void testBuild()
+{
+	for (int directed = 0; directed < 2; directed++)
+	{
+		int n = 200;
+		vector<GraphEdge> edgeList = randomEdges(n, 1500, 3 + directed);
+		CSRGraph<int, int> csr(n, edgeList, directed == 1);
+		AdjacencyMatrixGraph<int, int> matrix(n, directed == 1);
+		matrix.loadEdges(edgeList);
+		check(sameGraph(csr, matrix), "an edge-list build matches the adjacency matrix");
+		check(csr.directed() == (directed == 1), "an edge-list build keeps its direction");
+	}
+}
+
+//a snapshot of a directed graph is directed, so a one-way edge can be deleted on its own
+void testDirectedSnapshot()
+{
+	AdjacencyMatrixGraph<int, int> matrix(4, true);
+	matrix.addEdge(0, 1);
+	matrix.addEdge(1, 2);
+	matrix.addEdge(2, 1);
+	matrix.addEdge(3, 3);
+	CSRGraph<int, int> snapshot(matrix);
+	check(snapshot.directed(), "a snapshot of a directed graph is directed");
+	check(sameGraph(snapshot, matrix), "a directed snapshot has the source's edges");
+	snapshot.deleteEdge(0, 1);
+	check(!snapshot.hasEdge(0, 1) && snapshot.hasEdge(1, 2) && snapshot.hasEdge(2, 1), "deleting a one-way edge touches only it");
+	snapshot.deleteEdge(1, 2);
+	check(snapshot.hasEdge(2, 1) && (snapshot.edgeCount() == 2), "deleting one direction keeps the other");
+	bool threw = false;
+	try { snapshot.deleteEdge(0, 1); }
+	catch (GraphException&) { threw = true; }
+	check(threw, "deleting a missing edge throws");
+}
+
+//an undirected snapshot keeps the info of an edge the same from both ends
+void testUndirectedInfo()
+{
+	AdjacencyMatrixGraph<int, int> matrix(5);
+	matrix.addEdge(0, 1);
+	matrix.addEdge(1, 4);
+	matrix.addEdge(2, 2);
+	CSRGraph<int, int> snapshot(matrix);
+	check(!snapshot.directed() && (snapshot.edgeCount() == 3), "a snapshot of an undirected graph is undirected");
+	int info = 42;
+	snapshot.setEdgeInfo(4, 1, info);
+	check((snapshot.edgeInfo(1, 4) == 42) && (snapshot.edgeInfo(4, 1) == 42), "setEdgeInfo() updates both ends");
+	info = 7;
+	snapshot.setEdgeInfo(2, 2, info);
+	check(snapshot.edgeInfo(2, 2) == 7, "setEdgeInfo() on a self loop");
+	snapshot.deleteEdge(1, 0);
+	check(!snapshot.hasEdge(0, 1) && !snapshot.hasEdge(1, 0) && (snapshot.edgeCount() == 2), "an undirected delete removes both ends");
+}
+
+//sums every neighbor id of every vertex, the core of any traversal
+void benchmark(int n, int m)
+{
+	vector<GraphEdge> edgeList = randomEdges(n, m, 77);
+	CSRGraph<int, int> csr(n, edgeList);
+	AdjacencyMatrixGraph<int, int> matrix(n);
+	matrix.loadEdges(edgeList);
+	long long sums[2] = { 0, 0 };
+	double seconds[2];
+	for (int method = 0; method < 2; method++)
+	{
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int round = 0; round < 5; round++)
+			for (int v = 0; v < n; v++)
+			{
+				auto add = [&](int w) { sums[method] += w; };
+				if (method == 0) csr.forEachNeighbor(v, add);
+				else matrix.forEachNeighbor(v, add);
+			}
+		seconds[method] = chrono::duration<double>(chrono::steady_clock::now() - started).count() / 5;
+	}
+	check(sums[0] == sums[1], "benchmark scans agree");
+	cout << "  " << n << " vertices, " << csr.edgeCount() << " edges:  CSRGraph " << (seconds[0] * 1e3)
+		<< " ms, AdjacencyMatrixGraph " << (seconds[1] * 1e3) << " ms per full scan" << endl;
+}
+
+int main()
+{
+	testBuild();
+	testDirectedSnapshot();
+	testUndirectedInfo();
+	cout << "CSRGraph checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (scan of every neighbor list):" << endl;
+	benchmark(8000, 64000);
+	return (failures == 0) ? 0 : 1;
+}
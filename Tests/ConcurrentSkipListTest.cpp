@@ -0,0 +1,223 @@
+/*	ConcurrentSkipListTest.cpp
+*	Test and benchmark driver for ConcurrentSkipList.  The single-threaded checks compare the
+*	list with std::set after random inserts and removes.  The stress test runs threads that
+*	churn keys of their own and keys shared with every other thread, then checks that the
+*	list is sorted, holds no duplicates and holds exactly the keys each thread left in it; a
+*	second stress test races overwrites against removes of the same keys.  The benchmark
+*	reports operations per second for 1, 2, 4 and 8 threads.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <set>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <climits>
+#include "ConcurrentSkipList.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator, one state per thread
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//returns the elements of the list in enumeration order
+vector<int> contents(ConcurrentSkipList<int>& list)
+{
+	vector<int> result;
+	Enumeration<int>* e = list.rangeEnumerator(INT_MIN, INT_MAX);
+	while (e->hasMoreElements())
+		result.push_back(e->nextElement());
+	delete e;
+	return result;
+}
+
+//random single-threaded operations checked against std::set
+void testSequential()
+{
+	ConcurrentSkipList<int> list;
+	set<int> reference;
+	srand(1);
+	for (int i = 0; i < 20000; i++)
+	{
+		int key = rand() % 2000;
+		if (rand() % 3 == 0)
+		{
+			bool removed = true;
+			try { list.remove(key); }
+			catch (BinarySearchTreeNotFound&) { removed = false; }
+			check(removed == (reference.erase(key) == 1), "remove reports whether the key was present");
+		}
+		else
+		{
+			list.insert(key);
+			reference.insert(key);
+		}
+	}
+	vector<int> all = contents(list);
+	check(all == vector<int>(reference.begin(), reference.end()), "sequential contents match std::set");
+	check(list.Size() == (int)reference.size(), "sequential Size()");
+	for (int key = 0; key < 2000; key++)
+		check(list.contains(key) == (reference.count(key) == 1), "sequential contains()");
+}
+
+//threads churn private and shared keys; at the end each thread inserts its even private
+//keys and removes its odd ones, so the final private contents are known exactly
+void testStress(int threads)
+{
+	const int perThread = 5000;
+	const int shared = 500;
+	ConcurrentSkipList<int> list;
+	vector<thread> workers;
+	for (int t = 0; t < threads; t++)
+	{
+		workers.push_back(thread([&list, t]()
+		{
+			unsigned int seed = 17 + t;
+			int base = shared + t * perThread;
+			for (int i = 0; i < 4 * perThread; i++)
+			{
+				int key = (nextRandom(seed) % 2 == 0) ? base + nextRandom(seed) % perThread : nextRandom(seed) % shared;
+				if (nextRandom(seed) % 2 == 0) list.insert(key);
+				else
+				{
+					try { list.remove(key); }
+					catch (BinarySearchTreeNotFound&) { }
+				}
+			}
+			for (int i = 0; i < perThread; i++)
+			{
+				if (i % 2 == 0) list.insert(base + i);
+				else
+				{
+					try { list.remove(base + i); }
+					catch (BinarySearchTreeNotFound&) { }
+				}
+			}
+		}));
+	}
+	for (unsigned int t = 0; t < workers.size(); t++)
+		workers[t].join();
+
+	vector<int> all = contents(list);
+	bool sorted = true;
+	for (unsigned int i = 1; i < all.size(); i++)
+		if (!(all[i - 1] < all[i])) sorted = false;
+	check(sorted, "stress contents are strictly increasing");
+	check(list.Size() == (int)all.size(), "stress Size() matches enumeration");
+	bool exact = true;
+	for (int t = 0; t < threads; t++)
+		for (int i = 0; i < perThread; i++)
+			if (list.contains(shared + t * perThread + i) != (i % 2 == 0)) exact = false;
+	check(exact, "stress private keys are exactly the even ones");
+	list.reclaim();
+	check(contents(list) == all, "reclaim() keeps the live elements");
+}
+
+//one thread removes every key while another overwrites the same keys.  An overwrite that
+//starts after the remove of its key has returned must leave the key present, and one that
+//races with the remove must leave the list consistent either way.
+void testOverwriteRace()
+{
+	const int keys = 50000;
+	ConcurrentSkipList<int> list;
+	for (int k = 0; k < keys; k++)
+		list.insert(k);
+	atomic<int> removedUpTo(-1);
+	vector<char> mustRemain(keys, 0);
+	thread remover([&]()
+	{
+		for (int k = 0; k < keys; k++)
+		{
+			try { list.remove(k); }
+			catch (BinarySearchTreeNotFound&) { }
+			removedUpTo.store(k);
+		}
+	});
+	thread writer([&]()
+	{
+		for (int k = 0; k < keys; k++)
+		{
+			bool afterRemove = (removedUpTo.load() >= k);
+			list.insert(k);
+			if (afterRemove) mustRemain[k] = 1;
+		}
+	});
+	remover.join();
+	writer.join();
+	int lost = 0;
+	for (int k = 0; k < keys; k++)
+		if (mustRemain[k] && !list.contains(k)) lost++;
+	check(lost == 0, "an insert after the remove of its key is never lost");
+	vector<int> all = contents(list);
+	check(list.Size() == (int)all.size(), "overwrite race leaves a consistent list");
+}
+
+//benchmark:  a mix of 80% contains, 10% insert and 10% remove over 100,000 keys
+void benchmark(int threads)
+{
+	const int range = 100000;
+	const int perThread = 400000;
+	ConcurrentSkipList<int> list;
+	for (int k = 0; k < range; k += 2)
+		list.insert(k);
+	vector<thread> workers;
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	for (int t = 0; t < threads; t++)
+	{
+		workers.push_back(thread([&list, t]()
+		{
+			unsigned int seed = 99 + t;
+			for (int i = 0; i < perThread; i++)
+			{
+				int key = nextRandom(seed) % range;
+				int op = nextRandom(seed) % 10;
+				if (op == 0) list.insert(key);
+				else if (op == 1)
+				{
+					try { list.remove(key); }
+					catch (BinarySearchTreeNotFound&) { }
+				}
+				else list.contains(key);
+			}
+		}));
+	}
+	for (unsigned int t = 0; t < workers.size(); t++)
+		workers[t].join();
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	cout << "  " << threads << " threads:  " << (threads * (double)perThread / seconds / 1e6) << " M ops/s" << endl;
+}
+
+int main()
+{
+	testSequential();
+	testStress(4);
+	testOverwriteRace();
+	cout << "ConcurrentSkipList checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (80% contains, 10% insert, 10% remove):" << endl;
+	int counts[] = { 1, 2, 4, 8 };
+	for (int i = 0; i < 4; i++)
+		benchmark(counts[i]);
+	return (failures == 0) ? 0 : 1;
+}
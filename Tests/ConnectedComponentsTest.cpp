@@ -0,0 +1,194 @@
+/*	ConnectedComponentsTest.cpp
+*	Test and benchmark driver for ConnectedComponents.  Components of random sparse graphs,
+*	held as a CSRGraph, as a BitAdjacencyGraph and as a bare edge list, are checked against a
+*	serial breadth-first labelling with one, two and four threads:  the numbering must follow
+*	the smallest vertex of each component and the sizes must add up.  A directed graph must give
+*	its weakly connected components, and bad input must be refused.  The benchmark labels a
+*	large sparse graph from its edge list and from its CSR form.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <chrono>
+#include "CSRGraph.h"
+#include "BitAdjacencyGraph.h"
+#include "ConnectedComponents.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random edge list over n vertices
+vector<GraphEdge> randomEdges(int n, int edges, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(edges);
+	for (int i = 0; i < edges; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = 1;
+	}
+	return edgeList;
+}
+
+//labels the components by breadth-first search in order of their smallest vertex
+vector<int> serialLabels(CSRGraph<int, int>& g)
+{
+	int n = g.vertexCount();
+	vector<int> label(n, -1);
+	int components = 0;
+	for (int s = 0; s < n; s++)
+	{
+		if (label[s] >= 0) continue;
+		queue<int> Q;
+		Q.push(s);
+		label[s] = components;
+		while (!Q.empty())
+		{
+			int v = Q.front();
+			Q.pop();
+			for (const int* w = g.neighborBegin(v); w < g.neighborEnd(v); w++)
+			{
+				if (label[*w] >= 0) continue;
+				label[*w] = components;
+				Q.push(*w);
+			}
+		}
+		components++;
+	}
+	return label;
+}
+
+//true if cc numbers the vertices as expected and its sizes agree with the labels
+bool matches(ConnectedComponents& cc, const vector<int>& expected)
+{
+	int n = (int)expected.size();
+	if (cc.vertexCount() != n) return false;
+	if (cc.labels() != expected) return false;
+	vector<int> sizes(cc.componentCount(), 0);
+	for (int v = 0; v < n; v++)
+		sizes[expected[v]]++;
+	return (cc.sizes() == sizes);
+}
+
+//every graph form against the serial labelling, with several thread counts
+void testAgainstSerial()
+{
+	const int n = 2000;
+	vector<GraphEdge> edgeList = randomEdges(n, 1100, 23);
+	CSRGraph<int, int> csr(n, edgeList);
+	BitAdjacencyGraph<int, int> bits(n);
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+		if (!bits.hasEdge(edgeList[i].start, edgeList[i].end))
+			bits.addEdge(edgeList[i].start, edgeList[i].end);
+	vector<int> expected = serialLabels(csr);
+
+	int threadCounts[] = { 1, 2, 4 };
+	for (int t = 0; t < 3; t++)
+	{
+		ThreadPool pool(threadCounts[t]);
+		ConnectedComponents fromCSR(csr, pool);
+		ConnectedComponents fromBits(bits, pool);
+		ConnectedComponents fromList(n, edgeList, pool);
+		check(matches(fromCSR, expected), "components of a CSRGraph match the serial search");
+		check(matches(fromBits, expected), "components of a BitAdjacencyGraph match the serial search");
+		check(matches(fromList, expected), "components of an edge list match the serial search");
+		check(fromList.connected(edgeList[0].start, edgeList[0].end), "the ends of an edge are connected");
+		check(fromList.componentSize(fromList.component(0)) == fromList.sizes()[expected[0]], "componentSize()");
+	}
+}
+
+//edges of a directed graph join their ends whichever way they point
+void testDirected()
+{
+	vector<GraphEdge> edgeList(3);
+	edgeList[0].start = 1; edgeList[0].end = 0; edgeList[0].weight = 1;
+	edgeList[1].start = 2; edgeList[1].end = 0; edgeList[1].weight = 1;
+	edgeList[2].start = 4; edgeList[2].end = 3; edgeList[2].weight = 1;
+	CSRGraph<int, int> g(6, edgeList, true);
+	ThreadPool pool(2);
+	ConnectedComponents cc(g, pool);
+	check(cc.componentCount() == 3, "a directed graph gives its weakly connected components");
+	check(cc.connected(1, 2) && cc.connected(3, 4) && !cc.connected(0, 3), "weakly connected vertices");
+	check((cc.component(5) == 2) && (cc.componentSize(2) == 1), "an isolated vertex is its own component");
+}
+
+//bad vertices and counts are refused
+void testErrors()
+{
+	ThreadPool pool(1);
+	vector<GraphEdge> edgeList = randomEdges(4, 3, 5);
+	edgeList[2].end = 4;
+	bool threw = false;
+	try { ConnectedComponents cc(4, edgeList, pool); }
+	catch (GraphEdgeOutOfBounds&) { threw = true; }
+	check(threw, "an edge past the last vertex is refused");
+	threw = false;
+	try { ConnectedComponents cc(-1, vector<GraphEdge>(), pool); }
+	catch (GraphNegativeCount&) { threw = true; }
+	check(threw, "a negative vertex count is refused");
+
+	ConnectedComponents empty(0, vector<GraphEdge>(), pool);
+	check(empty.componentCount() == 0, "no vertices, no components");
+	threw = false;
+	try { empty.component(0); }
+	catch (GraphVertexOutOfBounds&) { threw = true; }
+	check(threw, "component() of a vertex out of range throws");
+}
+
+//labelling a large sparse graph from its edge list and from its CSR form
+void benchmark(int n, int edges, int threads)
+{
+	vector<GraphEdge> edgeList = randomEdges(n, edges, 31);
+	CSRGraph<int, int> csr(n, edgeList);
+	ThreadPool pool(threads);
+
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	ConnectedComponents fromList(n, edgeList, pool);
+	double listSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	started = chrono::steady_clock::now();
+	ConnectedComponents fromCSR(csr, pool);
+	double csrSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	started = chrono::steady_clock::now();
+	vector<int> expected = serialLabels(csr);
+	double serialSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+	check(fromList.labels() == expected && fromCSR.labels() == expected, "benchmark labellings agree");
+	cout << "  " << n << " vertices, " << edges << " edges, " << pool.threadCount() << " threads, "
+		<< fromList.componentCount() << " components:  edge list " << (listSeconds * 1e3) << " ms, CSR "
+		<< (csrSeconds * 1e3) << " ms, serial breadth-first " << (serialSeconds * 1e3) << " ms" << endl;
+}
+
+int main()
+{
+	testAgainstSerial();
+	testDirected();
+	testErrors();
+	cout << "ConnectedComponents checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(1000000, 1000000, 1);
+	benchmark(1000000, 1000000, 4);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,219 @@
+/*	EdgeListLoaderTest.cpp
+*	Test and benchmark driver for EdgeListLoader.  A small text file with comments, blank
+*	lines, commas, carriage returns, extra columns and missing weights must give the expected
+*	list.  A text file many chunks long must give the same list with one and four threads,
+*	including lines that straddle chunk boundaries, and binary files must round trip.  Bad ids,
+*	weights and record sizes, and a weight token too long to copy, must be refused.  The
+*	benchmark times text and binary loads of the same large list.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include "EdgeListLoader.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//writes bytes to a file
+void writeFile(const char* filename, const string& bytes)
+{
+	ofstream out(filename, ios::binary);
+	out.write(bytes.data(), bytes.size());
+}
+
+//true if two lists hold the same edges in the same order
+bool sameEdges(const vector<GraphEdge>& a, const vector<GraphEdge>& b)
+{
+	if (a.size() != b.size()) return false;
+	for (size_t i = 0; i < a.size(); i++)
+		if ((a[i].start != b[i].start) || (a[i].end != b[i].end) || (a[i].weight != b[i].weight)) return false;
+	return true;
+}
+
+//a random list with whole-number or half-integer weights, which print exactly
+vector<GraphEdge> randomEdges(int n, int edges, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(edges);
+	for (int i = 0; i < edges; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = (nextRandom(seed) % 2000) / 2.0;
+	}
+	return edgeList;
+}
+
+//writes a list as text, one edge per line, with a comment every so often
+string asText(const vector<GraphEdge>& edgeList)
+{
+	ostringstream out;
+	out << "# random edges\n";
+	for (size_t i = 0; i < edgeList.size(); i++)
+	{
+		out << edgeList[i].start << '\t' << edgeList[i].end << '\t' << edgeList[i].weight << '\n';
+		if (i % 1000 == 999) out << "% checkpoint\n";
+	}
+	return out.str();
+}
+
+//writes a list as packed binary records
+string asBinary(const vector<GraphEdge>& edgeList, bool weighted)
+{
+	string bytes;
+	for (size_t i = 0; i < edgeList.size(); i++)
+	{
+		int32_t ends[2] = { edgeList[i].start, edgeList[i].end };
+		bytes.append((const char*)ends, sizeof(ends));
+		if (weighted) bytes.append((const char*)&edgeList[i].weight, sizeof(double));
+	}
+	return bytes;
+}
+
+//true if loading the file throws EdgeListFormatError
+bool refused(EdgeListLoader& loader, const char* filename, const string& bytes, EdgeListFormat format)
+{
+	writeFile(filename, bytes);
+	bool threw = false;
+	try { loader.load(filename, format); }
+	catch (EdgeListFormatError&) { threw = true; }
+	remove(filename);
+	return threw;
+}
+
+//every text feature on a file of a few lines
+void testSmallText()
+{
+	const char* filename = "edgelist_test.txt";
+	writeFile(filename, "# comment\n% another\n\n0 1\n1,2,2.5\r\n  3\t4 0.25 extra columns\n\n2 0 -1e3");
+	ThreadPool pool(2);
+	EdgeListLoader loader(pool);
+	loader.load(filename);
+	GraphEdge expected[4] = { { 0, 1, 1.0 }, { 1, 2, 2.5 }, { 3, 4, 0.25 }, { 2, 0, -1000.0 } };
+	check(sameEdges(loader.edges(), vector<GraphEdge>(expected, expected + 4)), "small text file");
+	check(loader.vertexCount() == 5, "vertexCount() is one more than the largest id");
+
+	writeFile(filename, "");
+	loader.load(filename);
+	check(loader.edges().empty() && (loader.vertexCount() == 0), "an empty file gives an empty list");
+	remove(filename);
+}
+
+//a file many chunks long, with one and four threads, and the binary formats
+void testLargeFiles()
+{
+	const char* filename = "edgelist_test.bin";
+	vector<GraphEdge> edgeList = randomEdges(100000, 1500000, 13);
+	string text = asText(edgeList);
+	check(text.size() > 4 * EDGE_LIST_CHUNK_BYTES, "the text file spans several chunks");
+	int threadCounts[] = { 1, 4 };
+	for (int t = 0; t < 2; t++)
+	{
+		ThreadPool pool(threadCounts[t]);
+		EdgeListLoader loader(pool);
+		writeFile(filename, text);
+		loader.load(filename);
+		check(sameEdges(loader.edges(), edgeList), "a text file many chunks long loads in order");
+		writeFile(filename, asBinary(edgeList, false));
+		loader.load(filename, EDGE_LIST_BINARY);
+		bool ok = (loader.edges().size() == edgeList.size());
+		for (size_t i = 0; ok && (i < edgeList.size()); i++)
+			ok = (loader.edges()[i].start == edgeList[i].start) && (loader.edges()[i].end == edgeList[i].end)
+				&& (loader.edges()[i].weight == 1.0);
+		check(ok, "a binary file loads with unit weights");
+		writeFile(filename, asBinary(edgeList, true));
+		loader.load(filename, EDGE_LIST_BINARY_WEIGHTED);
+		check(sameEdges(loader.edges(), edgeList), "a weighted binary file round trips");
+	}
+	remove(filename);
+}
+
+//malformed files are refused rather than loaded wrongly
+void testRefusals()
+{
+	const char* filename = "edgelist_test.txt";
+	ThreadPool pool(2);
+	EdgeListLoader loader(pool);
+	string longest = "1." + string(EDGE_LIST_WEIGHT_LENGTH - 2, '0');
+	writeFile(filename, "0 1 " + longest + "\n");
+	loader.load(filename);
+	check((loader.edges().size() == 1) && (loader.edges()[0].weight == 1.0), "a weight token of the longest length");
+	remove(filename);
+
+	check(refused(loader, filename, "0 1 " + longest + "5\n", EDGE_LIST_TEXT), "a weight token too long is refused");
+	check(refused(loader, filename, "0 1 " + longest + "0000000000\n", EDGE_LIST_TEXT),
+		"a weight token much too long is refused");
+	check(refused(loader, filename, "0 1 2x\n", EDGE_LIST_TEXT), "a weight with trailing garbage is refused");
+	check(refused(loader, filename, "0 -1\n", EDGE_LIST_TEXT), "a negative id is refused");
+	check(refused(loader, filename, "0\n", EDGE_LIST_TEXT), "a line with one id is refused");
+	check(refused(loader, filename, "0 2147483648\n", EDGE_LIST_TEXT), "an id past 32 bits is refused");
+	check(refused(loader, filename, string(12, '\0'), EDGE_LIST_BINARY), "a partial binary record is refused");
+	int32_t negative[2] = { 3, -4 };
+	check(refused(loader, filename, string((const char*)negative, sizeof(negative)), EDGE_LIST_BINARY),
+		"a negative binary id is refused");
+
+	bool threw = false;
+	try { loader.load("edgelist_missing.txt"); }
+	catch (MappedFileOpenError&) { threw = true; }
+	check(threw, "a missing file throws MappedFileOpenError");
+}
+
+//text and binary loads of the same large list
+void benchmark(int edges, int threads)
+{
+	const char* filename = "edgelist_bench.bin";
+	vector<GraphEdge> edgeList = randomEdges(1000000, edges, 17);
+	ThreadPool pool(threads);
+	EdgeListLoader loader(pool);
+	string formats[2] = { asText(edgeList), asBinary(edgeList, true) };
+	for (int f = 0; f < 2; f++)
+	{
+		writeFile(filename, formats[f]);
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		loader.load(filename, (f == 0) ? EDGE_LIST_TEXT : EDGE_LIST_BINARY_WEIGHTED);
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+		check(sameEdges(loader.edges(), edgeList), "benchmark loads keep every edge");
+		cout << "  " << edges << " edges, " << pool.threadCount() << " threads, " << ((f == 0) ? "text" : "binary")
+			<< " file of " << formats[f].size() << " bytes:  " << (seconds * 1e3) << " ms, "
+			<< (edges / seconds / 1e6) << " M edges/s" << endl;
+	}
+	remove(filename);
+}
+
+int main()
+{
+	testSmallText();
+	testLargeFiles();
+	testRefusals();
+	cout << "EdgeListLoader checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(5000000, 1);
+	benchmark(5000000, 4);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+/*	EytzingerIndexTest.cpp
+*	Test and benchmark driver for EytzingerIndex.  lowerBound(), contains() and find() are
+*	checked against std::lower_bound for every size up to 300, for int keys and for keys larger
+*	than a cache line, and an index frozen from a BinarySearchTree is checked against the tree.
+*	The benchmark times random lookups in the tree, in a sorted vector and in the index.
+*	Build with the repository root on the include path.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include "EytzingerIndex.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a key that fills two cache lines, so the prefetch stride is at its minimum
+struct WideKey
+{
+	int value;
+	char padding[124];
+
+	WideKey(int v = 0) : value(v) { }
+	bool operator< (const WideKey& k) const { return value < k.value; }
+	bool operator> (const WideKey& k) const { return value > k.value; }
+	bool operator== (const WideKey& k) const { return value == k.value; }
+};
+
+ostream& operator<< (ostream& os, const WideKey& k)
+{
+	return os << k.value;
+}
+
+//int keys:  every query from below the first key to above the last, for every size up to 300
+void testIntKeys()
+{
+	vector<int> small;
+	for (int n = 0; n <= 300; n++)
+	{
+		EytzingerIndex<int> index(small);
+		bool ok = true;
+		for (int q = -1; q <= 3 * n + 1; q++)
+		{
+			vector<int>::iterator expected = lower_bound(small.begin(), small.end(), q);
+			const int* found = index.lowerBound(q);
+			ok = ok && ((expected == small.end()) ? (found == NULL) : (found != NULL && *found == *expected));
+		}
+		check(ok, "int keys match std::lower_bound");
+		small.push_back(3 * n + 1);
+	}
+}
+
+//wide keys:  every query from below the first key to above the last, for every size up to 300
+void testWideKeys()
+{
+	for (int n = 0; n <= 300; n++)
+	{
+		vector<WideKey> sorted;
+		for (int i = 0; i < n; i++)
+			sorted.push_back(WideKey(3 * i + 1));
+		EytzingerIndex<WideKey> index(sorted);
+		bool ok = (index.Size() == n) && (index.isEmpty() == (n == 0));
+		for (int q = -1; q <= 3 * n + 1; q++)
+		{
+			vector<WideKey>::iterator expected = lower_bound(sorted.begin(), sorted.end(), WideKey(q));
+			const WideKey* found = index.lowerBound(WideKey(q));
+			if (expected == sorted.end()) ok = ok && (found == NULL);
+			else ok = ok && (found != NULL) && (found->value == expected->value);
+			ok = ok && (index.contains(WideKey(q)) == (q % 3 == 1 && q < 3 * n));
+		}
+		check(ok, "wide keys match std::lower_bound");
+	}
+}
+
+//the index must answer as the tree it was frozen from
+void testFromTree()
+{
+	BinarySearchTree<int> tree;
+	unsigned int seed = 5;
+	for (int i = 0; i < 5000; i++)
+		tree.insert(nextRandom(seed) % 20000);
+	EytzingerIndex<int> index(tree);
+	bool ok = (index.Size() == tree.Size());
+	for (int q = 0; q < 20000; q++)
+		ok = ok && (index.contains(q) == tree.contains(q));
+	check(ok, "index frozen from a tree matches the tree");
+	bool threw = false;
+	try { index.find(-1); }
+	catch (BinarySearchTreeNotFound&) { threw = true; }
+	check(threw, "find() of a missing key throws");
+}
+
+//random lookups in a tree, a sorted vector and an index of the same keys
+void benchmark(int n, int lookups)
+{
+	BinarySearchTree<int> tree;
+	vector<int> keys(n);
+	for (int i = 0; i < n; i++)
+		keys[i] = 2 * i;
+	vector<int> shuffled(keys);
+	unsigned int seed = 11;
+	for (int i = n - 1; i > 0; i--)
+		swap(shuffled[i], shuffled[nextRandom(seed) % (i + 1)]);
+	for (int i = 0; i < n; i++)
+		tree.insert(shuffled[i]);
+	EytzingerIndex<int> index(keys);
+	vector<int> queries(lookups);
+	for (int i = 0; i < lookups; i++)
+		queries[i] = nextRandom(seed) % (2 * n);
+
+	long long hits[3] = { 0, 0, 0 };
+	double seconds[3];
+	for (int method = 0; method < 3; method++)
+	{
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < lookups; i++)
+		{
+			if (method == 0) hits[0] += tree.contains(queries[i]);
+			else if (method == 1) hits[1] += binary_search(keys.begin(), keys.end(), queries[i]);
+			else hits[2] += index.contains(queries[i]);
+		}
+		seconds[method] = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	}
+	check((hits[0] == hits[1]) && (hits[1] == hits[2]), "benchmark methods agree");
+	cout << "  " << n << " keys:  tree " << (seconds[0] / lookups * 1e9) << " ns, sorted vector "
+		<< (seconds[1] / lookups * 1e9) << " ns, Eytzinger " << (seconds[2] / lookups * 1e9) << " ns per lookup" << endl;
+}
+
+int main()
+{
+	testWideKeys();
+	testIntKeys();
+	testFromTree();
+	cout << "EytzingerIndex checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (random lookups, half of them hits):" << endl;
+	benchmark(1000, 2000000);
+	benchmark(1000000, 2000000);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,246 @@
+/*	GraphFileTest.cpp
+*	Test and benchmark driver for GraphFile and MappedGraph.  Directed and undirected graphs,
+*	saved both from a CSRGraph and from an AdjacencyMatrixGraph, must map back with the same
+*	direction, neighbor lists, weights and vertex and edge data.  Changes to a mapped graph
+*	must stay out of the file, and structural changes must be refused.  Headers with a section
+*	out of the file, a section off its boundary, an offset that would wrap around, or the wrong
+*	data sizes must be rejected.  The benchmark compares mapping a snapshot with rebuilding it
+*	from the edge list.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <chrono>
+#include <cstdio>
+#include "AdjacencyMatrixGraph.h"
+#include "CSRGraph.h"
+#include "GraphFile.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random edge list over n vertices with weights 1 to 9
+vector<GraphEdge> randomEdges(int n, int m, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(m);
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = 1 + nextRandom(seed) % 9;
+	}
+	return edgeList;
+}
+
+//true if both graphs have the same direction, vertices, edges and weights
+template <class GraphA, class GraphB>
+bool sameGraph(GraphA& a, GraphB& b)
+{
+	if ((a.directed() != b.directed()) || (a.vertexCount() != b.vertexCount()) || (a.edgeCount() != b.edgeCount()))
+		return false;
+	for (int v = 0; v < a.vertexCount(); v++)
+	{
+		vector<int> nbors = a.neighbors(v);
+		if (nbors != b.neighbors(v)) return false;
+		for (unsigned int i = 0; i < nbors.size(); i++)
+			if (a.edgeWeight(v, nbors[i]) != b.edgeWeight(v, nbors[i])) return false;
+	}
+	return true;
+}
+
+//returns the bytes of a file
+vector<char> fileBytes(const char* filename)
+{
+	ifstream in(filename, ios::binary);
+	return vector<char>((istreambuf_iterator<char>(in)), istreambuf_iterator<char>());
+}
+
+//CSR snapshots of both directions, with vertex and edge data, mapped back
+void testCSRRoundTrip()
+{
+	const char* filename = "graphfile_test.bin";
+	for (int directed = 0; directed < 2; directed++)
+	{
+		int n = 300;
+		CSRGraph<int, int> g(n, randomEdges(n, 2000, 5 + directed), directed == 1);
+		for (int v = 0; v < n; v++)
+		{
+			int info = 1000 + v;
+			g.setVertexInfo(v, info);
+			for (const int* w = g.neighborBegin(v); w < g.neighborEnd(v); w++)
+			{
+				int edgeInfo = v * n + *w;
+				if (directed || (v <= *w)) g.setEdgeInfo(v, *w, edgeInfo);
+			}
+		}
+		GraphFile<int, int>::save(g, filename);
+		MappedGraph<int, int> mapped(filename);
+		check(sameGraph(g, mapped), "a mapped CSR snapshot matches its source");
+		bool data = true;
+		for (int v = 0; v < n; v++)
+		{
+			data = data && (mapped.vertexInfo(v) == 1000 + v) && (mapped.degree(v) == g.degree(v));
+			for (const int* w = mapped.neighborBegin(v); w < mapped.neighborEnd(v); w++)
+				data = data && (mapped.edgeInfo(v, *w) == g.edgeInfo(v, *w));
+		}
+		check(data, "vertex and edge data are mapped back");
+	}
+	remove(filename);
+}
+
+//saving any graph keeps its direction:  one-way edges stay one way
+void testAbstractSave()
+{
+	const char* filename = "graphfile_test.bin";
+	for (int directed = 0; directed < 2; directed++)
+	{
+		AdjacencyMatrixGraph<int, int> matrix(6, directed == 1);
+		matrix.addEdge(0, 1);
+		matrix.addEdge(1, 2);
+		matrix.addEdge(4, 3);
+		GraphFile<int, int>::save((AbstractGraph<int, int>&)matrix, filename);
+		MappedGraph<int, int> mapped(filename);
+		check(mapped.directed() == (directed == 1), "a saved graph keeps its direction");
+		check(sameGraph(matrix, mapped), "a saved adjacency matrix maps back unchanged");
+		check(mapped.hasEdge(1, 0) == (directed == 0), "the reverse of an edge exists only when undirected");
+	}
+	remove(filename);
+}
+
+//a mapped graph may change its data privately but never its structure
+void testReadOnly()
+{
+	const char* filename = "graphfile_test.bin";
+	vector<GraphEdge> edgeList = randomEdges(50, 200, 9);
+	CSRGraph<int, int> g(50, edgeList);
+	GraphFile<int, int>::save(g, filename);
+	vector<char> before = fileBytes(filename);
+	{
+		MappedGraph<int, int> mapped(filename);
+		int info = -5;
+		mapped.setVertexInfo(3, info);
+		mapped.setEdgeInfo(edgeList[0].start, edgeList[0].end, info);
+		check((mapped.vertexInfo(3) == -5) && (mapped.edgeInfo(edgeList[0].start, edgeList[0].end) == -5),
+			"a mapped graph sees its own changes");
+		bool threw = false;
+		try { mapped.addEdge(0, 0, 1.0); }
+		catch (GraphReadOnly&) { threw = true; }
+		check(threw, "addEdge() on a mapped graph throws");
+		threw = false;
+		try { mapped.deleteEdge(edgeList[0].start, edgeList[0].end); }
+		catch (GraphReadOnly&) { threw = true; }
+		check(threw, "deleteEdge() on a mapped graph throws");
+	}
+	check(fileBytes(filename) == before, "changes to a mapped graph never reach the file");
+	remove(filename);
+}
+
+//rewrites one header of a valid file and expects the mapping to be refused
+template <class Damage>
+void testDamagedHeader(Damage damage, const char* what)
+{
+	const char* filename = "graphfile_test.bin";
+	CSRGraph<int, int> g(40, randomEdges(40, 100, 11));
+	GraphFile<int, int>::save(g, filename);
+	vector<char> bytes = fileBytes(filename);
+	GraphFileHeader header;
+	memcpy(&header, bytes.data(), sizeof(header));
+	damage(header, bytes);
+	memcpy(bytes.data(), &header, sizeof(header));
+	{
+		ofstream out(filename, ios::binary | ios::trunc);
+		out.write(bytes.data(), bytes.size());
+	}
+	bool rejected = false;
+	try { MappedGraph<int, int> mapped(filename); }
+	catch (GraphFileFormat&) { rejected = true; }
+	check(rejected, what);
+	remove(filename);
+}
+
+//every kind of damage checkHeader() must catch
+void testDamagedHeaders()
+{
+	testDamagedHeader([](GraphFileHeader& h, vector<char>&) { h.magic[0] = 'X'; }, "a bad magic number is rejected");
+	testDamagedHeader([](GraphFileHeader& h, vector<char>&) { h.edgeSize = 8; }, "the wrong edge data size is rejected");
+	testDamagedHeader([](GraphFileHeader& h, vector<char>&) { h.vertexCount = (uint64_t)1 << 40; },
+		"a vertex count past int is rejected");
+	testDamagedHeader([](GraphFileHeader&, vector<char>& bytes) { bytes.resize(bytes.size() - 1); },
+		"a truncated file is rejected");
+	testDamagedHeader([](GraphFileHeader& h, vector<char>&) { h.weightsAt += 4; },
+		"a section off its boundary is rejected");
+	testDamagedHeader([](GraphFileHeader& h, vector<char>&) { h.targetsAt = (uint64_t)0 - GRAPH_FILE_ALIGN; },
+		"a section offset that wraps around is rejected");
+	testDamagedHeader([](GraphFileHeader& h, vector<char>& bytes) { h.edgeDataAt = bytes.size() + GRAPH_FILE_ALIGN; },
+		"a section past the end of the file is rejected");
+}
+
+//mapping a saved snapshot against rebuilding it from the edge list
+void benchmark(int n, int m)
+{
+	const char* filename = "graphfile_bench.bin";
+	vector<GraphEdge> edgeList = randomEdges(n, m, 21);
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	CSRGraph<int, int> g(n, edgeList);
+	double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	started = chrono::steady_clock::now();
+	GraphFile<int, int>::save(g, filename);
+	double saveSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+	started = chrono::steady_clock::now();
+	MappedGraph<int, int> mapped(filename);
+	double mapSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	long long sums[2] = { 0, 0 };
+	started = chrono::steady_clock::now();
+	for (int v = 0; v < n; v++)
+	{
+		auto add = [&](int w) { sums[0] += w; };
+		mapped.forEachNeighbor(v, add);
+	}
+	double scanSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	for (int v = 0; v < n; v++)
+	{
+		auto add = [&](int w) { sums[1] += w; };
+		g.forEachNeighbor(v, add);
+	}
+	check(sums[0] == sums[1], "benchmark scans agree");
+	cout << "  " << n << " vertices, " << g.edgeCount() << " edges, " << fileBytes(filename).size() << " bytes:  build "
+		<< (buildSeconds * 1e3) << " ms, save " << (saveSeconds * 1e3) << " ms, map " << (mapSeconds * 1e3)
+		<< " ms, first scan of the mapping " << (scanSeconds * 1e3) << " ms" << endl;
+	remove(filename);
+}
+
+int main()
+{
+	testCSRRoundTrip();
+	testAbstractSave();
+	testReadOnly();
+	testDamagedHeaders();
+	cout << "GraphFile checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(1000000, 5000000);
+	return (failures == 0) ? 0 : 1;
+}
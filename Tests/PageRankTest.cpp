@@ -0,0 +1,215 @@
+/*	PageRankTest.cpp
+*	Test and benchmark driver for PageRank.  Ordinary, personalized and weighted scores of random
+*	directed and undirected graphs, dangling vertices included, are checked against a serial power
+*	iteration over neighbors() and edgeWeight():  they must agree, sum to 1, and be exactly the
+*	same whether the pool has one thread or several.  multiply() is checked against the edges, and
+*	bad personalizations, negative weights and wrong vector sizes must throw.  The benchmark times
+*	the iterations on a large sparse graph.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <chrono>
+#include "CSRGraph.h"
+#include "PageRank.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random edge list over n vertices with weights 1 to 9; the last tenth of the vertices start no edges
+vector<GraphEdge> randomEdges(int n, int m, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(m);
+	int starts = n - n / 10;
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % starts;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = 1 + nextRandom(seed) % 9;
+	}
+	return edgeList;
+}
+
+//serial power iteration pushing rank along the out-edges, for a fixed number of steps
+vector<double> reference(CSRGraph<int, int>& g, const vector<double>& teleport, bool weighted, int steps)
+{
+	int n = g.vertexCount();
+	double damping = PAGERANK_DAMPING;
+	vector<double> rank = teleport;
+	for (int step = 0; step < steps; step++)
+	{
+		vector<double> next(n, 0.0);
+		double dangling = 0;
+		for (int u = 0; u < n; u++)
+		{
+			vector<int> nbors = g.neighbors(u);
+			double total = 0;
+			for (unsigned int i = 0; i < nbors.size(); i++)
+				total += weighted ? g.edgeWeight(u, nbors[i]) : 1.0;
+			if (total == 0)
+			{
+				dangling += rank[u];
+				continue;
+			}
+			for (unsigned int i = 0; i < nbors.size(); i++)
+				next[nbors[i]] += damping * rank[u] * (weighted ? g.edgeWeight(u, nbors[i]) : 1.0) / total;
+		}
+		for (int v = 0; v < n; v++)
+			next[v] += ((1.0 - damping) + damping * dangling) * teleport[v];
+		rank.swap(next);
+	}
+	return rank;
+}
+
+//largest difference between two score vectors
+double maxDifference(const vector<double>& a, const vector<double>& b)
+{
+	double largest = 0;
+	for (unsigned int i = 0; i < a.size(); i++)
+		largest = max(largest, fabs(a[i] - b[i]));
+	return largest;
+}
+
+//sum of a score vector
+double total(const vector<double>& x)
+{
+	double sum = 0;
+	for (unsigned int i = 0; i < x.size(); i++)
+		sum += x[i];
+	return sum;
+}
+
+//ordinary, personalized and weighted scores of one graph against the reference and across pools
+void testGraph(bool directed, const char* what)
+{
+	const int n = 3000;
+	CSRGraph<int, int> g(n, randomEdges(n, 12000, 3 + directed), directed);
+	ThreadPool single(1), several(4);
+	vector<double> uniform(n, 1.0 / n);
+	vector<double> preference(n, 0.0), teleport(n, 0.0);
+	preference[0] = 3;
+	preference[7] = 1;
+	teleport[0] = 0.75;
+	teleport[7] = 0.25;
+
+	bool ok = true;
+	for (int weighted = 0; weighted < 2; weighted++)
+	{
+		PageRank one(g, single, weighted == 1), four(g, several, weighted == 1);
+		one.setTolerance(1e-13);
+		four.setTolerance(1e-13);
+		vector<double> ranks = one.run();
+		ok = ok && (ranks == four.run()) && (one.iterations() == four.iterations());
+		ok = ok && (one.residual() < 1e-13) && (fabs(total(ranks) - 1.0) < 1e-9);
+		ok = ok && (maxDifference(ranks, reference(g, uniform, weighted == 1, 200)) < 1e-10);
+
+		vector<double> personal = one.run(preference);
+		ok = ok && (personal == four.run(preference)) && (fabs(total(personal) - 1.0) < 1e-9);
+		ok = ok && (maxDifference(personal, reference(g, teleport, weighted == 1, 200)) < 1e-10);
+		ok = ok && (one.ranks() == personal);
+	}
+	check(ok, what);
+}
+
+//iteration limits, multiply() and every error
+void testEdgeCases()
+{
+	ThreadPool pool(3);
+	vector<GraphEdge> edgeList;
+	GraphEdge edges[] = { { 0, 1, 2.0 }, { 1, 2, 1.0 }, { 2, 0, 1.0 }, { 0, 2, 1.0 } };
+	for (int i = 0; i < 4; i++)
+		edgeList.push_back(edges[i]);
+	CSRGraph<int, int> g(4, edgeList, true);
+
+	PageRank rank(g, pool);
+	rank.setMaxIterations(3);
+	rank.run();
+	check(rank.iterations() == 3, "a run stops at the iteration limit");
+	rank.setMaxIterations(PAGERANK_MAX_ITERATIONS);
+	rank.setDamping(0);
+	rank.run();
+	check((maxDifference(rank.ranks(), vector<double>(4, 0.25)) < 1e-15) && (rank.iterations() == 1),
+		"with no damping the scores are the teleport distribution");
+
+	PageRank weighted(g, pool, true);
+	vector<double> x = { 1, 10, 100, 1000 }, y;
+	weighted.multiply(x, y);
+	check(y == vector<double>({ 100, 2, 11, 0 }), "multiply() sums weighted in-edges");
+	rank.multiply(x, y);
+	check(y == vector<double>({ 100, 1, 11, 0 }), "multiply() of an unweighted snapshot counts in-edges");
+
+	int threw = 0;
+	try { rank.run(vector<double>(3, 1.0)); }
+	catch (GraphBadPersonalization&) { threw++; }
+	try { rank.run(vector<double>({ 1, -1, 1, 1 })); }
+	catch (GraphBadPersonalization&) { threw++; }
+	try { rank.run(vector<double>(4, 0.0)); }
+	catch (GraphBadPersonalization&) { threw++; }
+	check(threw == 3, "a bad personalization throws");
+	threw = 0;
+	try { rank.multiply(vector<double>(5, 1.0), y); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	check(threw == 1, "multiply() of the wrong size throws");
+
+	edgeList[1].weight = -1;
+	CSRGraph<int, int> negative(4, edgeList, true);
+	threw = 0;
+	try { PageRank bad(negative, pool, true); }
+	catch (GraphNegativeEdgeWeight&) { threw++; }
+	check(threw == 1, "a negative weight throws in weighted mode");
+	PageRank unweighted(negative, pool);
+	check(fabs(total(unweighted.run()) - 1.0) < 1e-9, "weights are ignored when unweighted");
+}
+
+//snapshot and iterations of a large random graph
+void benchmark(int n, int m, int threads)
+{
+	CSRGraph<int, int> g(n, randomEdges(n, m, 31), true);
+	ThreadPool pool(threads);
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	PageRank rank(g, pool);
+	double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	rank.setTolerance(0);
+	rank.setMaxIterations(20);
+	started = chrono::steady_clock::now();
+	rank.run();
+	double runSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	check(fabs(total(rank.ranks()) - 1.0) < 1e-6, "benchmark scores sum to 1");
+	cout << "  " << n << " vertices, " << g.edgeCount() << " edges, " << threads << " threads:  snapshot "
+		<< (buildSeconds * 1e3) << " ms, " << (runSeconds / rank.iterations() * 1e3) << " ms per iteration" << endl;
+}
+
+int main()
+{
+	testGraph(false, "undirected scores match the reference");
+	testGraph(true, "directed scores match the reference");
+	testEdgeCases();
+	cout << "PageRank checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(1000000, 8000000, 1);
+	benchmark(1000000, 8000000, 4);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,163 @@
+/*	PersistentBinarySearchTreeTest.cpp
+*	Test driver for PersistentBinarySearchTree.  Random inserts and removes are checked against
+*	std::set, with snapshots taken along the way that must keep their contents.  A million keys
+*	inserted in sorted order must leave a tree of logarithmic height, and freeing it must not
+*	overflow the stack.  Finally reader threads take snapshots while writer threads update the
+*	tree, and every snapshot must be a sorted tree whose size matches its contents.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <set>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include "PersistentBinarySearchTree.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator, one state per thread
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//returns true if the tree holds exactly the keys of reference, out of the range [0, range)
+bool matches(const PersistentBinarySearchTree<int>& tree, const set<int>& reference, int range)
+{
+	if (tree.Size() != (int)reference.size()) return false;
+	for (int key = 0; key < range; key++)
+		if (tree.contains(key) != (reference.count(key) == 1)) return false;
+	return true;
+}
+
+//random operations checked against std::set, with snapshots checked at the end
+void testSequential()
+{
+	const int range = 3000;
+	PersistentBinarySearchTree<int> tree;
+	set<int> reference;
+	vector<PersistentBinarySearchTree<int>> snapshots;
+	vector<set<int>> expected;
+	unsigned int seed = 7;
+	for (int i = 0; i < 30000; i++)
+	{
+		int key = nextRandom(seed) % range;
+		if (nextRandom(seed) % 3 == 0)
+		{
+			bool removed = true;
+			try { tree.remove(key); }
+			catch (BinarySearchTreeNotFound&) { removed = false; }
+			check(removed == (reference.erase(key) == 1), "remove reports whether the key was present");
+		}
+		else
+		{
+			tree.insert(key);
+			reference.insert(key);
+		}
+		if (i % 5000 == 0)
+		{
+			snapshots.push_back(tree.snapshot());
+			expected.push_back(reference);
+		}
+	}
+	check(matches(tree, reference, range), "contents match std::set");
+	for (unsigned int s = 0; s < snapshots.size(); s++)
+		check(matches(snapshots[s], expected[s], range), "a snapshot keeps its contents");
+	if (!reference.empty())
+		check(tree.find(*reference.begin()) == *reference.begin(), "find() returns the matching data");
+	tree.makeEmpty();
+	check(tree.isEmpty() && !snapshots.back().isEmpty(), "makeEmpty() leaves snapshots alone");
+}
+
+//sorted input must not degrade the tree
+void testSortedInput()
+{
+	const int count = 1000000;
+	PersistentBinarySearchTree<int> tree;
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	for (int key = 0; key < count; key++)
+		tree.insert(key);
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	int height = tree.Height();
+	cout << "  " << count << " sorted inserts:  height " << height << ", "
+		<< (count / seconds / 1e6) << " M inserts/s" << endl;
+	check(height <= 60, "sorted input leaves a tree of logarithmic height");
+	check(tree.Size() == count, "sorted input Size()");
+	for (int key = 0; key < count; key += 2)
+		tree.remove(key);
+	check(tree.Size() == count / 2 && tree.contains(1) && !tree.contains(0), "removes after sorted input");
+}
+
+//writers update disjoint key ranges while readers check snapshots
+void testConcurrent(int writers, int readers)
+{
+	const int perWriter = 20000;
+	PersistentBinarySearchTree<int> tree;
+	atomic<bool> done(false);
+	atomic<int> badSnapshots(0);
+	vector<thread> threads;
+	for (int w = 0; w < writers; w++)
+	{
+		threads.push_back(thread([&tree, w]()
+		{
+			for (int i = 0; i < perWriter; i++)
+				tree.insert(w * perWriter + i);
+			for (int i = 1; i < perWriter; i += 2)
+				tree.remove(w * perWriter + i);
+		}));
+	}
+	for (int r = 0; r < readers; r++)
+	{
+		threads.push_back(thread([&tree, &done, &badSnapshots]()
+		{
+			while (!done.load())
+			{
+				PersistentBinarySearchTree<int> view = tree.snapshot();
+				int size = view.Size();
+				int found = 0;
+				for (int key = 0; key < 2000; key++)
+					if (view.contains(key)) found++;
+				if ((found > size) || (view.Size() != size)) badSnapshots++;
+			}
+		}));
+	}
+	for (int w = 0; w < writers; w++)
+		threads[w].join();
+	done.store(true);
+	for (unsigned int t = writers; t < threads.size(); t++)
+		threads[t].join();
+
+	check(badSnapshots.load() == 0, "every snapshot is self-consistent");
+	check(tree.Size() == writers * perWriter / 2, "concurrent writers lose no updates");
+	bool exact = true;
+	for (int key = 0; key < writers * perWriter; key++)
+		if (tree.contains(key) != (key % 2 == 0)) exact = false;
+	check(exact, "concurrent writers leave exactly the even keys");
+}
+
+int main()
+{
+	testSequential();
+	testSortedInput();
+	testConcurrent(4, 2);
+	cout << "PersistentBinarySearchTree checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+	return (failures == 0) ? 0 : 1;
+}
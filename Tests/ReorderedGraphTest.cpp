@@ -0,0 +1,295 @@
+/*	ReorderedGraphTest.cpp
+*	Test and benchmark driver for ReorderedGraph.  Directed and undirected graphs, built as
+*	CSRGraph and AdjacencyMatrixGraph, are reordered by every method and checked:  the new ids
+*	must be a permutation, every edge must map to an edge with the same weight and data and none
+*	may be added, vertex data must move with its vertex, the copy must keep the direction of its
+*	source, and degree order must not increase.  On a grid with shuffled ids, RCM and BFS must
+*	shrink the bandwidth.  The benchmark times ParallelBFS searches and PageRank iterations over a
+*	shuffled grid and over each reordering of it, and checks that the levels and ranks agree.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <chrono>
+#include "AdjacencyMatrixGraph.h"
+#include "CSRGraph.h"
+#include "ReorderedGraph.h"
+#include "ThreadPool.h"
+#include "ParallelBFS.h"
+#include "PageRank.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+const ReorderMethod methods[] = { REORDER_NONE, REORDER_DEGREE, REORDER_RCM, REORDER_BFS };
+const char* methodNames[] = { "none", "degree", "RCM", "BFS" };
+
+//a random edge list over n vertices with weights 1 to 9
+vector<GraphEdge> randomEdges(int n, int m, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(m);
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = nextRandom(seed) % n;
+		edgeList[i].end = nextRandom(seed) % n;
+		edgeList[i].weight = 1 + nextRandom(seed) % 9;
+	}
+	return edgeList;
+}
+
+//a side by side grid whose vertex ids are shuffled
+vector<GraphEdge> shuffledGrid(int side, unsigned int seed)
+{
+	int n = side * side;
+	vector<int> label(n);
+	for (int v = 0; v < n; v++)
+		label[v] = v;
+	for (int v = n - 1; v > 0; v--)
+		swap(label[v], label[nextRandom(seed) % (v + 1)]);
+	vector<GraphEdge> edgeList;
+	for (int r = 0; r < side; r++)
+		for (int c = 0; c < side; c++)
+		{
+			GraphEdge e = { label[r * side + c], 0, 1.0 };
+			if (c + 1 < side)
+			{
+				e.end = label[r * side + c + 1];
+				edgeList.push_back(e);
+			}
+			if (r + 1 < side)
+			{
+				e.end = label[(r + 1) * side + c];
+				edgeList.push_back(e);
+			}
+		}
+	return edgeList;
+}
+
+//true if r is g under a permutation of its ids, with the same direction, edges, weights and data
+template <class GraphType>
+bool isRelabelling(GraphType& g, ReorderedGraph<int, int>& r)
+{
+	int n = g.vertexCount();
+	if ((r.vertexCount() != n) || (r.edgeCount() != g.edgeCount()) || (r.directed() != g.directed())) return false;
+	vector<bool> seen(n, false);
+	for (int v = 0; v < n; v++)
+	{
+		int w = r.newId(v);
+		if ((w < 0) || (w >= n) || seen[w] || (r.oldId(w) != v) || (r.newToOld()[w] != v) || (r.oldToNew()[v] != w))
+			return false;
+		seen[w] = true;
+	}
+	for (int u = 0; u < n; u++)
+	{
+		if ((r.originalVertexInfo(u) != g.vertexInfo(u)) || (r.degree(r.newId(u)) != (int)g.neighbors(u).size()))
+			return false;
+		vector<int> nbors = g.neighbors(u);
+		for (unsigned int i = 0; i < nbors.size(); i++)
+		{
+			int a = r.newId(u), b = r.newId(nbors[i]);
+			if (!r.hasEdge(a, b) || (r.edgeWeight(a, b) != g.edgeWeight(u, nbors[i]))) return false;
+			if (r.edgeInfo(a, b) != g.edgeInfo(u, nbors[i])) return false;
+		}
+		vector<int> row = r.neighbors(r.newId(u));
+		for (unsigned int i = 1; i < row.size(); i++)
+			if (row[i - 1] >= row[i]) return false;
+	}
+	return true;
+}
+
+//gives every vertex and every stored edge of g distinct data
+template <class GraphType>
+void label(GraphType& g)
+{
+	for (int v = 0; v < g.vertexCount(); v++)
+	{
+		int info = 1000 + v;
+		g.setVertexInfo(v, info);
+		vector<int> nbors = g.neighbors(v);
+		for (unsigned int i = 0; i < nbors.size(); i++)
+		{
+			int edgeInfo = v * g.vertexCount() + nbors[i];
+			if (g.directed() || (v <= nbors[i])) g.setEdgeInfo(v, nbors[i], edgeInfo);
+		}
+	}
+}
+
+//every method on CSR and adjacency matrix graphs of both directions
+void testRelabelling()
+{
+	const int n = 200;
+	bool ok = true, degreeOrder = true;
+	for (int directed = 0; directed < 2; directed++)
+	{
+		vector<GraphEdge> edgeList = randomEdges(n, 700, 13 + directed);
+		CSRGraph<int, int> csr(n, edgeList, directed == 1);
+		AdjacencyMatrixGraph<int, int> matrix(n, directed == 1);
+		matrix.loadEdges(edgeList);
+		label(csr);
+		label(matrix);
+		for (int m = 0; m < 4; m++)
+		{
+			ReorderedGraph<int, int> fromCSR(csr, methods[m]);
+			ReorderedGraph<int, int> fromMatrix(matrix, methods[m]);
+			ok = ok && isRelabelling(csr, fromCSR) && isRelabelling(matrix, fromMatrix);
+			if (methods[m] == REORDER_NONE) ok = ok && (fromCSR.oldToNew()[n - 1] == n - 1);
+			if (methods[m] != REORDER_DEGREE) continue;
+			for (int v = 1; v < n; v++)
+				degreeOrder = degreeOrder && (fromCSR.degree(v - 1) >= fromCSR.degree(v));
+		}
+	}
+	check(ok, "every reordering is a relabelling of its source");
+	check(degreeOrder, "degree order does not increase");
+}
+
+//RCM and BFS shrink the bandwidth of a shuffled grid; results map back to original ids
+void testLocality()
+{
+	int side = 30;
+	CSRGraph<int, int> grid(side * side, shuffledGrid(side, 19));
+	ReorderedGraph<int, int> none(grid, REORDER_NONE);
+	ReorderedGraph<int, int> rcm(grid, REORDER_RCM);
+	ReorderedGraph<int, int> bfs(grid, REORDER_BFS);
+	check((rcm.bandwidth() <= 2 * side) && (bfs.bandwidth() <= 2 * side) && (none.bandwidth() > 10 * side),
+		"RCM and BFS bring a shuffled grid back to a narrow band");
+	check((rcm.averageGap() < none.averageGap() / 10) && (bfs.averageGap() < none.averageGap() / 10),
+		"RCM and BFS shrink the average gap");
+
+	vector<int> byNewId(side * side);
+	for (int v = 0; v < side * side; v++)
+		byNewId[v] = rcm.oldId(v);
+	vector<int> byOldId = rcm.toOriginalOrder(byNewId);
+	bool ok = true;
+	for (int v = 0; v < side * side; v++)
+		ok = ok && (byOldId[v] == v);
+	check(ok, "toOriginalOrder() indexes results by original id");
+
+	int threw = 0;
+	try { rcm.newId(side * side); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	try { rcm.oldId(-1); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	try { rcm.toOriginalOrder(vector<int>(3)); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	check(threw == 3, "out-of-range ids and sizes throw");
+}
+
+//bfs levels from the numbers and parents of a search, -1 for unreached vertices
+vector<int> levels(const vector<int>& number, const vector<int>& parent)
+{
+	int n = number.size();
+	vector<int> byNumber(n, -1), level(n, -1);
+	for (int v = 0; v < n; v++)
+		if (number[v] > 0) byNumber[number[v] - 1] = v;
+	for (int i = 0; (i < n) && (byNumber[i] >= 0); i++)
+	{
+		int v = byNumber[i];
+		level[v] = (parent[v] < 0) ? 0 : level[parent[v]] + 1;
+	}
+	return level;
+}
+
+//ParallelBFS and PageRank over one graph, with levels and ranks returned by the ids of grid
+template <class GraphType>
+void benchmarkGraph(GraphType& g, ThreadPool& pool, const vector<int>& sources, int iterations, const char* name,
+	ReorderedGraph<int, int>* r, vector<vector<int>>& levelsBySource, vector<double>& ranks, double reference[2])
+{
+	ParallelBFS bfs(pool);
+	vector<int> parent(g.vertexCount());
+	levelsBySource.resize(sources.size());
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	for (unsigned int i = 0; i < sources.size(); i++)
+	{
+		int u = (r == NULL) ? sources[i] : r->newId(sources[i]);
+		vector<int> number = bfs.search(g, u, parent);
+		levelsBySource[i] = levels(number, parent);
+	}
+	double bfsSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+
+	PageRank rank(g, pool);
+	rank.setTolerance(0);
+	rank.setMaxIterations(iterations);
+	started = chrono::steady_clock::now();
+	ranks = rank.run();
+	double rankSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	if (r != NULL)
+	{
+		for (unsigned int i = 0; i < sources.size(); i++)
+			levelsBySource[i] = r->toOriginalOrder(levelsBySource[i]);
+		ranks = r->toOriginalOrder(ranks);
+	}
+
+	if (reference[0] < 0)
+	{
+		reference[0] = bfsSeconds;
+		reference[1] = rankSeconds;
+	}
+	cout << "    " << name << ":  " << sources.size() << " searches " << (bfsSeconds * 1e3) << " ms (x"
+		<< (reference[0] / bfsSeconds) << "), " << iterations << " PageRank iterations " << (rankSeconds * 1e3)
+		<< " ms (x" << (reference[1] / rankSeconds) << ")" << endl;
+}
+
+//ParallelBFS and PageRank over a shuffled grid and over each reordering of it
+void benchmark(int side, int iterations)
+{
+	int n = side * side;
+	CSRGraph<int, int> grid(n, shuffledGrid(side, 23));
+	ThreadPool pool;
+	vector<int> sources;
+	for (int i = 0; i < 4; i++)
+		sources.push_back(i * (n / 4));
+	cout << "  " << side << " x " << side << " shuffled grid, " << pool.threadCount() << " threads:" << endl;
+
+	double reference[2] = { -1, -1 };
+	vector<vector<int>> originalLevels, reorderedLevels;
+	vector<double> originalRanks, reorderedRanks;
+	cout << "    original:  bandwidth " << ReorderedGraph<int, int>(grid, REORDER_NONE).bandwidth() << endl;
+	benchmarkGraph(grid, pool, sources, iterations, "original", NULL, originalLevels, originalRanks, reference);
+	bool sameLevels = true, sameRanks = true;
+	for (int m = 1; m < 4; m++)
+	{
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		ReorderedGraph<int, int> r(grid, methods[m]);
+		double buildSeconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+		cout << "    " << methodNames[m] << ":  bandwidth " << r.bandwidth() << ", reorder " << (buildSeconds * 1e3) << " ms" << endl;
+		benchmarkGraph(r, pool, sources, iterations, methodNames[m], &r, reorderedLevels, reorderedRanks, reference);
+		sameLevels = sameLevels && (reorderedLevels == originalLevels);
+		for (int v = 0; v < n; v++)
+			sameRanks = sameRanks && (fabs(reorderedRanks[v] - originalRanks[v]) <= 1e-9 * originalRanks[v]);
+	}
+	check(sameLevels, "benchmark bfs levels agree with the original graph");
+	check(sameRanks, "benchmark ranks agree with the original graph");
+}
+
+int main()
+{
+	testRelabelling();
+	testLocality();
+	cout << "ReorderedGraph checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark(1000, 20);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,178 @@
+/*	ShortestPathsTest.cpp
+*	Test and benchmark driver for ShortestPaths, IndexedHeap and RadixHeap.  Distances from
+*	both heaps, point-to-point paths and A* with an admissible heuristic are checked against
+*	Floyd-Warshall on a random weighted graph; every parent and path must add up to the
+*	distance it claims.  The benchmark runs point-to-point queries on a weighted grid with each
+*	heap, and with A* under the Manhattan distance, and reports time and settled vertices.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include "CSRGraph.h"
+#include "ShortestPaths.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//true if path runs from source to target along edges of g whose weights add up to length
+bool validPath(CSRGraph<int, int>& g, const vector<int>& path, int source, int target, double length)
+{
+	if (path.empty() || (path.front() != source) || (path.back() != target)) return false;
+	double sum = 0;
+	for (unsigned int i = 1; i < path.size(); i++)
+	{
+		if (!g.hasEdge(path[i - 1], path[i])) return false;
+		sum += g.edgeWeight(path[i - 1], path[i]);
+	}
+	return sum == length;
+}
+
+//every query against Floyd-Warshall on a random graph with whole-number weights
+void testAgainstFloydWarshall()
+{
+	const int n = 250;
+	vector<GraphEdge> edgeList;
+	unsigned int seed = 5;
+	for (int i = 0; i < 1200; i++)
+	{
+		GraphEdge e;
+		e.start = nextRandom(seed) % n;
+		e.end = nextRandom(seed) % n;
+		e.weight = 1 + nextRandom(seed) % 20;
+		edgeList.push_back(e);
+	}
+	CSRGraph<int, int> g(n, edgeList);
+
+	vector<vector<double>> d(n, vector<double>(n, SHORTEST_PATH_INFINITY));
+	for (int v = 0; v < n; v++)
+	{
+		d[v][v] = 0;
+		for (const int* w = g.neighborBegin(v); w < g.neighborEnd(v); w++)
+			d[v][*w] = min(d[v][*w], g.edgeWeight(v, *w));
+	}
+	for (int k = 0; k < n; k++)
+		for (int i = 0; i < n; i++)
+			for (int j = 0; j < n; j++)
+				d[i][j] = min(d[i][j], d[i][k] + d[k][j]);
+
+	ShortestPaths sp(g);
+	for (int heap = 0; heap < 2; heap++)
+	{
+		sp.setHeap(heap == 0 ? SHORTEST_PATH_DARY_HEAP : SHORTEST_PATH_RADIX_HEAP);
+		bool distances = true, parents = true, paths = true, aStar = true;
+		for (int s = 0; s < n; s += 9)
+		{
+			vector<double> dist;
+			vector<int> parent;
+			sp.singleSource(s, dist, parent);
+			for (int t = 0; t < n; t++)
+			{
+				distances = distances && (dist[t] == d[s][t]);
+				if (parent[t] >= 0) parents = parents && (dist[parent[t]] + g.edgeWeight(parent[t], t) == dist[t]);
+			}
+			for (int t = 0; t < n; t += 7)
+			{
+				vector<int> path;
+				double length = sp.shortestPath(s, t, path);
+				paths = paths && (length == d[s][t]);
+				if (length != SHORTEST_PATH_INFINITY) paths = paths && validPath(g, path, s, t, length);
+				else paths = paths && path.empty();
+				length = sp.aStar(s, t, [&](int v) { return (d[v][t] == SHORTEST_PATH_INFINITY) ? 0.0 : d[v][t] / 2; }, path);
+				aStar = aStar && (length == d[s][t]);
+			}
+		}
+		check(distances, (heap == 0) ? "indexed heap distances match Floyd-Warshall" : "radix heap distances match Floyd-Warshall");
+		check(parents, "every parent edge is tight");
+		check(paths, "point-to-point paths add up to their distances");
+		check(aStar, "A* distances match Floyd-Warshall");
+	}
+
+	vector<GraphEdge> fractional(1);
+	fractional[0].start = 0;
+	fractional[0].end = 1;
+	fractional[0].weight = 0.5;
+	CSRGraph<int, int> h(2, fractional);
+	ShortestPaths fractionalPaths(h);
+	bool threw = false;
+	try { fractionalPaths.setHeap(SHORTEST_PATH_RADIX_HEAP); }
+	catch (GraphNonIntegerWeight&) { threw = true; }
+	check(threw, "the radix heap refuses fractional weights");
+}
+
+//corner-to-corner queries on a side x side grid with weights of 1 or 2, where the Manhattan
+//distance is a close lower bound
+void benchmark(int side)
+{
+	vector<GraphEdge> edgeList;
+	unsigned int seed = 42;
+	for (int i = 0; i < side; i++)
+		for (int j = 0; j < side; j++)
+		{
+			GraphEdge e;
+			e.start = i * side + j;
+			if (i + 1 < side)
+			{
+				e.end = (i + 1) * side + j;
+				e.weight = 1 + nextRandom(seed) % 2;
+				edgeList.push_back(e);
+			}
+			if (j + 1 < side)
+			{
+				e.end = i * side + j + 1;
+				e.weight = 1 + nextRandom(seed) % 2;
+				edgeList.push_back(e);
+			}
+		}
+	CSRGraph<int, int> g(side * side, edgeList);
+	ShortestPaths sp(g);
+	int target = side * side - 1;
+	auto manhattan = [&](int v) { return (double)((side - 1 - v / side) + (side - 1 - v % side)); };
+	const char* names[] = { "indexed heap", "radix heap", "A*, indexed heap" };
+	double lengths[3];
+	for (int method = 0; method < 3; method++)
+	{
+		sp.setHeap(method == 1 ? SHORTEST_PATH_RADIX_HEAP : SHORTEST_PATH_DARY_HEAP);
+		vector<int> path;
+		const int queries = 10;
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int q = 0; q < queries; q++)
+			lengths[method] = (method == 2) ? sp.aStar(0, target, manhattan, path) : sp.shortestPath(0, target, path);
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count() / queries;
+		cout << "  " << names[method] << ":  " << (seconds * 1e3) << " ms, " << sp.settledCount() << " vertices settled" << endl;
+	}
+	check((lengths[0] == lengths[1]) && (lengths[1] == lengths[2]), "benchmark queries agree");
+}
+
+int main()
+{
+	testAgainstFloydWarshall();
+	cout << "ShortestPaths checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (corner to corner on a 500 x 500 grid):" << endl;
+	benchmark(500);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,221 @@
+/*	SparseEdgeDataTest.cpp
+*	Test and benchmark driver for SparseEdgeData and the edge info of AdjacencyMatrixGraph and
+*	BitAdjacencyGraph.  Random sets, reads and erases are checked against std::map.  read() of
+*	edges without data must neither store anything nor move the data already stored, so a
+*	reference taken early stays valid through any number of reads, while get() must store a
+*	default entry so that a write through its reference is kept, as must a graph's edgeInfo().
+*	Reading the info of every edge of a graph with readEdgeInfo(), as a CSRGraph snapshot does,
+*	must leave its table empty.  The benchmark compares lookups with std::unordered_map.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <chrono>
+#include "SparseEdgeData.h"
+#include "AdjacencyMatrixGraph.h"
+#include "BitAdjacencyGraph.h"
+#include "CSRGraph.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//graphs that report how many edges their info table holds
+class InfoMatrixGraph : public AdjacencyMatrixGraph<int, int>
+{
+public:
+	InfoMatrixGraph(int n) : AdjacencyMatrixGraph<int, int>(n) { }
+	int infoEntries() { return this->_edgeData.Size(); }
+};
+
+class InfoBitGraph : public BitAdjacencyGraph<int, int>
+{
+public:
+	InfoBitGraph(int n) : BitAdjacencyGraph<int, int>(n) { }
+	int infoEntries() { return this->_edgeData.Size(); }
+};
+
+//random operations against std::map
+void testAgainstMap()
+{
+	SparseEdgeData<int> table;
+	map<pair<int, int>, int> model;
+	unsigned int seed = 41;
+	bool ok = table.isEmpty() && (table.find(0, 0) == NULL) && (table.read(0, 0) == 0);
+	for (int step = 0; step < 200000; step++)
+	{
+		int a = nextRandom(seed) % 300;
+		int b = nextRandom(seed) % 300;
+		int op = nextRandom(seed) % 4;
+		if (op < 2)
+		{
+			table.set(a, b, step);
+			model[make_pair(a, b)] = step;
+		}
+		else if (op == 2)
+			ok = ok && (table.erase(a, b) == (model.erase(make_pair(a, b)) == 1));
+		else
+		{
+			map<pair<int, int>, int>::iterator m = model.find(make_pair(a, b));
+			int expected = (m == model.end()) ? 0 : m->second;
+			ok = ok && (table.read(a, b) == expected) && (table.contains(a, b) == (m != model.end()));
+		}
+		ok = ok && (table.Size() == (int)model.size());
+	}
+	for (map<pair<int, int>, int>::iterator m = model.begin(); m != model.end(); m++)
+	{
+		int* found = table.find(m->first.first, m->first.second);
+		ok = ok && (found != NULL) && (*found == m->second);
+	}
+	check(ok, "random operations match std::map");
+	table.clear();
+	check(table.isEmpty() && !table.contains(0, 0), "clear() empties the table");
+}
+
+//read() never inserts or rehashes; get() stores a default so writes through it are kept
+void testReadsAndWrites()
+{
+	SparseEdgeData<int> table;
+	table.set(1, 2, 12);
+	int& stored = table.get(1, 2);
+	int* address = &stored;
+	for (int i = 0; i < 10000; i++)
+		table.read(i, i + 7);
+	check(table.Size() == 1, "reading edges without data stores nothing");
+	check((&table.read(1, 2) == address) && (stored == 12), "a reference survives many reads");
+	table.set(1, 2, 13);
+	check((&table.get(1, 2) == address) && (stored == 13), "overwriting an edge keeps its slot");
+
+	int& first = table.get(5, 5);
+	first = 99;
+	int& second = table.get(6, 6);
+	check((table.read(5, 5) == 99) && (first == 99) && (second == 0) && (table.Size() == 3),
+		"get() of an edge without data stores a default that keeps writes");
+	second = 4;
+	check((table.read(5, 5) == 99) && (table.read(6, 6) == 4) && (&table.get(5, 5) == &first),
+		"a later get() leaves earlier references alone");
+}
+
+//reading every edge's info, directly and through snapshots, leaves the graphs' tables empty;
+//writes through edgeInfo() are kept
+void testGraphReads()
+{
+	const int n = 200;
+	InfoMatrixGraph matrix(n);
+	InfoBitGraph bits(n);
+	unsigned int seed = 43;
+	for (int i = 0; i < 3000; i++)
+	{
+		int a = nextRandom(seed) % n;
+		int b = nextRandom(seed) % n;
+		if (matrix.hasEdge(a, b)) continue;
+		matrix.addEdge(a, b);
+		bits.addEdge(a, b);
+	}
+	int info = 7;
+	matrix.setEdgeInfo(3, matrix.neighbors(3)[0], info);
+	bits.setEdgeInfo(3, bits.neighbors(3)[0], info);
+	int& held = matrix.edgeInfo(3, matrix.neighbors(3)[0]);
+
+	long long sum = 0;
+	for (int v = 0; v < n; v++)
+	{
+		vector<int> nbors = matrix.neighbors(v);
+		for (unsigned int i = 0; i < nbors.size(); i++)
+			sum += matrix.readEdgeInfo(v, nbors[i]) + bits.readEdgeInfo(v, nbors[i]);
+	}
+	CSRGraph<int, int> matrixSnapshot(matrix);
+	CSRGraph<int, int> bitsSnapshot(bits);
+	check((matrix.infoEntries() == 1) && (bits.infoEntries() == 1), "reading every edge's info stores nothing");
+	check(sum == 4 * info, "reads see the one edge given info from both ends");
+	check(held == info, "a reference taken before the reads is still valid");
+	check(matrixSnapshot.edgeInfo(matrix.neighbors(3)[0], 3) == info, "a snapshot copies the info");
+
+	int a = 5, b = matrix.neighbors(5)[0];
+	matrix.edgeInfo(a, b) = 21;
+	bits.edgeInfo(a, b) = 22;
+	check((matrix.readEdgeInfo(b, a) == 21) && (bits.readEdgeInfo(b, a) == 22) && (matrix.infoEntries() == 2)
+		&& (bits.infoEntries() == 2), "a write through edgeInfo() is stored, under both ends");
+	matrix.deleteEdge(a, b);
+
+	matrix.deleteEdge(3, matrix.neighbors(3)[0]);
+	check(matrix.infoEntries() == 0, "deleting an edge erases its info");
+	int w = 0;
+	while (matrix.hasEdge(0, w))
+		w++;
+	bool threw = false;
+	try { matrix.setEdgeInfo(0, w, info); }
+	catch (GraphNonExistentEdge&) { threw = true; }
+	check(threw && (matrix.infoEntries() == 0), "setEdgeInfo() of a missing edge throws");
+}
+
+//lookups of present and absent edges against std::unordered_map
+void benchmark(int entries, int lookups)
+{
+	SparseEdgeData<int> table;
+	unordered_map<uint64_t, int> hashMap;
+	vector<pair<int, int>> keys(entries);
+	unsigned int seed = 47;
+	for (int i = 0; i < entries; i++)
+	{
+		keys[i] = make_pair((int)(nextRandom(seed) % 100000), (int)(nextRandom(seed) % 100000));
+		table.set(keys[i].first, keys[i].second, i);
+		hashMap[((uint64_t)keys[i].first << 32) | (uint32_t)keys[i].second] = i;
+	}
+	vector<pair<int, int>> queries(lookups);
+	for (int i = 0; i < lookups; i++)
+	{
+		if (i % 2 == 0) queries[i] = keys[nextRandom(seed) % entries];
+		else queries[i] = make_pair((int)(nextRandom(seed) % 100000), (int)(nextRandom(seed) % 100000));
+	}
+
+	long long hits[2] = { 0, 0 };
+	double seconds[2];
+	for (int method = 0; method < 2; method++)
+	{
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < lookups; i++)
+		{
+			if (method == 0) hits[0] += (table.find(queries[i].first, queries[i].second) != NULL);
+			else hits[1] += hashMap.count(((uint64_t)queries[i].first << 32) | (uint32_t)queries[i].second);
+		}
+		seconds[method] = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	}
+	check(hits[0] == hits[1], "benchmark lookups agree");
+	cout << "  " << table.Size() << " entries:  SparseEdgeData " << (seconds[0] / lookups * 1e9)
+		<< " ns, unordered_map " << (seconds[1] / lookups * 1e9) << " ns per lookup" << endl;
+}
+
+int main()
+{
+	testAgainstMap();
+	testReadsAndWrites();
+	testGraphReads();
+	cout << "SparseEdgeData checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (random lookups, half of them hits):" << endl;
+	benchmark(1000000, 5000000);
+	return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,210 @@
+/*	TriangleCounterTest.cpp
+*	Test and benchmark driver for TriangleCounter.  Random graphs with repeated edges, self
+*	loops and a few hubs are counted through CSRGraph, directed CSRGraph, AdjacencyMatrixGraph
+*	and BitAdjacencyGraph, with one pool thread and several, and checked against a brute-force
+*	count over every pair of neighbors:  the triangles through each vertex, the total and the
+*	clustering coefficients must all agree.  The benchmark counts a large sparse graph with
+*	sorted-list intersection and a dense graph with both paths.
+*	Build with the repository root on the include path and threads enabled.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <cmath>
+#include <chrono>
+#include "AdjacencyMatrixGraph.h"
+#include "BitAdjacencyGraph.h"
+#include "CSRGraph.h"
+#include "TriangleCounter.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//a random edge list over n vertices; every eighth edge starts at one of four hubs, and some are self loops
+vector<GraphEdge> randomEdges(int n, int m, unsigned int seed)
+{
+	vector<GraphEdge> edgeList(m);
+	for (int i = 0; i < m; i++)
+	{
+		edgeList[i].start = (i % 8 == 0) ? (int)(nextRandom(seed) % 4) : (int)(nextRandom(seed) % n);
+		edgeList[i].end = (i % 50 == 0) ? edgeList[i].start : (int)(nextRandom(seed) % n);
+		edgeList[i].weight = 1.0;
+	}
+	return edgeList;
+}
+
+//the counts every graph type should give, found by testing each pair of neighbors
+struct Expected
+{
+	vector<long long> triangles;
+	vector<int> degree;
+	long long total;
+};
+
+//brute-force triangle counts of an edge list with directions, repeats and self loops ignored
+Expected bruteForce(int n, const vector<GraphEdge>& edgeList)
+{
+	vector<set<int>> adjacent(n);
+	for (unsigned int i = 0; i < edgeList.size(); i++)
+	{
+		if (edgeList[i].start == edgeList[i].end) continue;
+		adjacent[edgeList[i].start].insert(edgeList[i].end);
+		adjacent[edgeList[i].end].insert(edgeList[i].start);
+	}
+	Expected e;
+	e.triangles.assign(n, 0);
+	e.degree.resize(n);
+	long long corners = 0;
+	for (int v = 0; v < n; v++)
+	{
+		vector<int> nbors(adjacent[v].begin(), adjacent[v].end());
+		e.degree[v] = (int)nbors.size();
+		for (unsigned int i = 0; i < nbors.size(); i++)
+			for (unsigned int j = i + 1; j < nbors.size(); j++)
+				e.triangles[v] += adjacent[nbors[i]].count(nbors[j]);
+		corners += e.triangles[v];
+	}
+	e.total = corners / 3;
+	return e;
+}
+
+//true if a counter agrees with the brute-force counts
+bool matches(TriangleCounter& counter, const Expected& e)
+{
+	int n = (int)e.degree.size();
+	if ((counter.vertexCount() != n) || (counter.triangleCount() != e.total) || (counter.vertexTriangles() != e.triangles))
+		return false;
+	double sum = 0, wedges = 0;
+	for (int v = 0; v < n; v++)
+	{
+		double d = e.degree[v];
+		double expected = (d < 2) ? 0.0 : 2.0 * e.triangles[v] / (d * (d - 1));
+		if ((counter.triangles(v) != e.triangles[v]) || (fabs(counter.clustering(v) - expected) > 1e-12)) return false;
+		sum += expected;
+		wedges += d * (d - 1) / 2;
+	}
+	if (fabs(counter.averageClustering() - ((n > 0) ? sum / n : 0.0)) > 1e-12) return false;
+	return fabs(counter.transitivity() - ((wedges > 0) ? 3.0 * e.total / wedges : 0.0)) < 1e-12;
+}
+
+//every graph type and pool size on one random graph
+void testGraph(int n, int m, unsigned int seed, const char* what)
+{
+	vector<GraphEdge> edgeList = randomEdges(n, m, seed);
+	Expected e = bruteForce(n, edgeList);
+	CSRGraph<int, int> undirected(n, edgeList);
+	CSRGraph<int, int> directed(n, edgeList, true);
+	AdjacencyMatrixGraph<int, int> matrix(n);
+	matrix.loadEdges(edgeList);
+	BitAdjacencyGraph<int, int> bits(n);
+	bits.loadEdges(edgeList);
+
+	bool ok = true;
+	int threads[] = { 1, 4 };
+	for (int t = 0; t < 2; t++)
+	{
+		ThreadPool pool(threads[t]);
+		TriangleCounter fromCSR(undirected, pool);
+		TriangleCounter fromDirected(directed, pool);
+		TriangleCounter fromMatrix(matrix, pool);
+		TriangleCounter fromBits(bits, pool);
+		ok = ok && matches(fromCSR, e) && matches(fromDirected, e) && matches(fromMatrix, e) && matches(fromBits, e);
+	}
+	check(ok, what);
+}
+
+//small graphs with known answers, and out-of-range vertices
+void testEdgeCases()
+{
+	ThreadPool pool(2);
+	CSRGraph<int, int> empty(0, vector<GraphEdge>());
+	TriangleCounter none(empty, pool);
+	check((none.triangleCount() == 0) && (none.averageClustering() == 0) && (none.transitivity() == 0),
+		"an empty graph has no triangles");
+
+	vector<GraphEdge> clique;
+	for (int a = 0; a < 5; a++)
+		for (int b = a + 1; b < 5; b++)
+		{
+			GraphEdge edge = { a, b, 1.0 };
+			clique.push_back(edge);
+		}
+	BitAdjacencyGraph<int, int> bits(5);
+	bits.loadEdges(clique);
+	TriangleCounter full(bits, pool);
+	check((full.triangleCount() == 10) && (full.triangles(2) == 6) && (full.clustering(4) == 1.0) && (full.transitivity() == 1.0),
+		"a clique of five has ten triangles and clustering 1");
+
+	int threw = 0;
+	try { full.triangles(5); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	try { full.clustering(-1); }
+	catch (GraphVertexOutOfBounds&) { threw++; }
+	check(threw == 2, "a vertex out of range throws");
+}
+
+//times one count and returns its total
+template <class GraphType>
+long long timeCount(GraphType& g, ThreadPool& pool, double& seconds)
+{
+	chrono::steady_clock::time_point started = chrono::steady_clock::now();
+	TriangleCounter counter(g, pool);
+	seconds = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	return counter.triangleCount();
+}
+
+//sorted-list intersection on a sparse graph, and both paths on a dense one
+void benchmark()
+{
+	ThreadPool pool(4);
+	double seconds[2];
+	int n = 1000000;
+	CSRGraph<int, int> sparse(n, randomEdges(n, 10000000, 61));
+	long long found = timeCount(sparse, pool, seconds[0]);
+	cout << "  " << n << " vertices, " << sparse.edgeCount() << " edges:  " << found << " triangles in "
+		<< (seconds[0] * 1e3) << " ms" << endl;
+
+	n = 4000;
+	vector<GraphEdge> edgeList = randomEdges(n, 1600000, 67);
+	CSRGraph<int, int> dense(n, edgeList);
+	BitAdjacencyGraph<int, int> bits(n);
+	bits.loadEdges(edgeList);
+	long long counts[2] = { timeCount(dense, pool, seconds[0]), timeCount(bits, pool, seconds[1]) };
+	check(counts[0] == counts[1], "benchmark counts agree");
+	cout << "  " << n << " vertices, " << dense.edgeCount() << " edges:  " << counts[0] << " triangles, sorted lists "
+		<< (seconds[0] * 1e3) << " ms, bit rows " << (seconds[1] * 1e3) << " ms" << endl;
+}
+
+int main()
+{
+	testGraph(40, 300, 3, "a small graph matches the brute-force count");
+	testGraph(300, 6000, 5, "a graph with hubs matches the brute-force count");
+	testGraph(700, 2000, 7, "a sparse graph matches the brute-force count");
+	testEdgeCases();
+	cout << "TriangleCounter checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark:" << endl;
+	benchmark();
+	return (failures == 0) ? 0 : 1;
+}
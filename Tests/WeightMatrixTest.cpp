@@ -0,0 +1,176 @@
+/*	WeightMatrixTest.cpp
+*	Test and benchmark driver for WeightMatrix.  For double, float, uint16_t and uint8_t weights,
+*	random writes are checked against a vector of rows:  every row must be aligned, and
+*	nextNonZero() from every column, negative ones included, and countNonZero() must agree with
+*	the rows.  Resizes must keep the entries that still fit, copies must be deep, and a resize
+*	that cannot be allocated must leave the matrix as it was.  The benchmark times a scan of
+*	every row of a sparse matrix with nextNonZero() and entry by entry.
+*	Build with the repository root on the include path.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include "WeightMatrix.h"
+
+using namespace std;
+
+int failures = 0;
+
+//records a failed check
+void check(bool ok, const char* what)
+{
+	if (ok) return;
+	failures++;
+	cout << "FAILED:  " << what << endl;
+}
+
+//xorshift generator
+unsigned int nextRandom(unsigned int& state)
+{
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+//true if m holds exactly the entries of model, with aligned rows and matching scans
+template <class WeightType>
+bool matches(const WeightMatrix<WeightType>& m, const vector<vector<WeightType>>& model)
+{
+	int n = (int)model.size();
+	if (m.size() != n) return false;
+	for (int i = 0; i < n; i++)
+	{
+		if (((uintptr_t)m[i] % WEIGHT_MATRIX_ALIGN) != 0) return false;
+		int count = 0;
+		for (int j = 0; j < n; j++)
+		{
+			if (m[i][j] != model[i][j]) return false;
+			count += (model[i][j] != 0);
+		}
+		if (m.countNonZero(i) != count) return false;
+		for (int from = -3; from <= n + 2; from++)
+		{
+			int expected = -1;
+			for (int j = (from < 0) ? 0 : from; (j < n) && (expected < 0); j++)
+				if (model[i][j] != 0) expected = j;
+			if (m.nextNonZero(i, from) != expected) return false;
+		}
+	}
+	return true;
+}
+
+//random writes, resizes and copies of one weight type
+template <class WeightType>
+void testType(const char* what)
+{
+	unsigned int seed = 53 + sizeof(WeightType);
+	int sizes[] = { 0, 1, 7, 64, 65, 130, 40 };
+	WeightMatrix<WeightType> m;
+	vector<vector<WeightType>> model;
+	bool ok = matches(m, model);
+	for (int s = 0; s < 7; s++)
+	{
+		int n = sizes[s];
+		m.resize(n);
+		model.resize(n);
+		for (int i = 0; i < n; i++)
+			model[i].resize(n, 0);
+		ok = ok && matches(m, model);
+		for (int k = 0; k < 3 * n; k++)
+		{
+			int i = nextRandom(seed) % n;
+			int j = nextRandom(seed) % n;
+			WeightType w = (WeightType)(nextRandom(seed) % 4);
+			m[i][j] = w;
+			model[i][j] = w;
+		}
+		ok = ok && matches(m, model);
+	}
+	check(ok, what);
+
+	WeightMatrix<WeightType> copied(m);
+	WeightMatrix<WeightType> assigned(3);
+	assigned = m;
+	m[0][0] = 9;
+	check(matches(copied, model) && matches(assigned, model), "copies are deep");
+	assigned = assigned;
+	check(matches(assigned, model), "self-assignment keeps the entries");
+}
+
+//a resize that cannot be allocated throws and leaves the size, stride and entries alone
+void testFailedResize()
+{
+	WeightMatrix<double> m(10);
+	m[3][4] = 2.5;
+	size_t stride = m.stride();
+	int sizes[] = { INT_MAX, 1 << 21 };
+	for (int s = 0; s < 2; s++)
+	{
+		bool threw = false;
+		try { m.resize(sizes[s]); }
+		catch (WeightMatrixMemory&) { threw = true; }
+		check(threw, "a resize too large for memory throws WeightMatrixMemory");
+		check((m.size() == 10) && (m.stride() == stride) && (m[3][4] == 2.5) && (m.nextNonZero(3, 0) == 4),
+			"a failed resize leaves the matrix as it was");
+	}
+	bool threw = false;
+	try { m.resize(-1); }
+	catch (WeightMatrixMemory&) { threw = true; }
+	check(threw && (m.size() == 10), "a negative size is refused");
+}
+
+//every neighbor of every row, found with nextNonZero() and by testing each entry
+template <class WeightType>
+void benchmark(int n, int perRow, const char* name)
+{
+	WeightMatrix<WeightType> m(n);
+	unsigned int seed = 59;
+	for (int i = 0; i < n; i++)
+		for (int k = 0; k < perRow; k++)
+			m[i][nextRandom(seed) % n] = 1;
+	long long sums[2] = { 0, 0 };
+	double seconds[2];
+	for (int method = 0; method < 2; method++)
+	{
+		chrono::steady_clock::time_point started = chrono::steady_clock::now();
+		for (int i = 0; i < n; i++)
+		{
+			if (method == 0)
+			{
+				for (int j = m.nextNonZero(i, 0); j >= 0; j = m.nextNonZero(i, j + 1))
+					sums[0] += j;
+			}
+			else
+			{
+				const WeightType* row = m[i];
+				for (int j = 0; j < n; j++)
+					if (row[j] != 0) sums[1] += j;
+			}
+		}
+		seconds[method] = chrono::duration<double>(chrono::steady_clock::now() - started).count();
+	}
+	check(sums[0] == sums[1], "benchmark scans agree");
+	cout << "  " << name << ", " << n << " x " << n << ", " << perRow << " per row:  nextNonZero " << (seconds[0] * 1e3)
+		<< " ms, entry by entry " << (seconds[1] * 1e3) << " ms" << endl;
+}
+
+int main()
+{
+	testType<double>("double weights match the model");
+	testType<float>("float weights match the model");
+	testType<uint16_t>("uint16_t weights match the model");
+	testType<uint8_t>("uint8_t weights match the model");
+	testFailedResize();
+	cout << "WeightMatrix checks:  " << (failures == 0 ? "passed" : "FAILED") << endl;
+
+	cout << "Benchmark (scan of every row):" << endl;
+	benchmark<double>(4000, 16, "double");
+	benchmark<uint8_t>(4000, 16, "uint8_t");
+	return (failures == 0) ? 0 : 1;
+}
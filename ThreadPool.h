@@ -0,0 +1,173 @@
+/*	ThreadPool.h
+*	ThreadPool keeps a fixed set of worker threads for the parallel graph algorithms.  Work is
+*	handed out fork-join style:  run() calls a task once on every thread, with the calling
+*	thread acting as thread 0, and returns when all of them have finished.  parallelFor() builds
+*	on run() and deals out a range of indices in chunks, so uneven work (such as vertices of
+*	very different degree) is balanced across the threads.  An exception thrown by a task is
+*	passed back to the caller of run().
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _THREADPOOL_H
+#define _THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+
+using namespace std;
+
+class ThreadPool
+{
+protected:
+	vector<thread> _workers;									//threads 1 .. threadCount()-1
+	mutex _mutex;
+	condition_variable _startSignal;							//workers wait here for a task
+	condition_variable _doneSignal;								//run() waits here for the workers
+	function<void(int)> _task;									//task of the current run()
+	long long _generation;										//incremented once per run()
+	int _pending;												//workers still running the current task
+	bool _stop;													//set by the destructor
+	exception_ptr _error;										//first exception thrown by a worker
+
+	void _workerLoop(int index);
+
+	ThreadPool(const ThreadPool& pool);							//pools are not copyable
+	void operator= (const ThreadPool& pool);
+
+public:
+	ThreadPool(int threads = 0);								//0 uses one thread per hardware thread
+	virtual ~ThreadPool();										//stops and joins the workers
+	int threadCount();											//returns the number of threads, caller included
+	void run(const function<void(int)>& task);					//runs task(i) on each thread i and waits
+	void parallelFor(int begin, int end, int chunk, const function<void(int, int, int)>& body);
+																//calls body(low, high, thread) over [begin, end)
+};
+
+
+//constructor -- starts threads - 1 workers; the caller of run() is the remaining thread
+inline ThreadPool::ThreadPool(int threads)
+{
+	if (threads <= 0)
+		threads = max(1, (int)thread::hardware_concurrency());
+	_generation = 0;
+	_pending = 0;
+	_stop = false;
+	for (int i = 1; i < threads; i++)
+		_workers.push_back(thread(&ThreadPool::_workerLoop, this, i));
+}
+
+//destructor -- wakes the workers so they can exit, then joins them
+inline ThreadPool::~ThreadPool()
+{
+	{
+		unique_lock<mutex> lock(_mutex);
+		_stop = true;
+	}
+	_startSignal.notify_all();
+	for (unsigned int i = 0; i < _workers.size(); i++)
+		_workers[i].join();
+}
+
+//returns the number of threads that run a task, including the caller
+inline int ThreadPool::threadCount()
+{
+	return (int)_workers.size() + 1;
+}
+
+//worker thread:  waits for each new generation, runs the task and reports completion
+inline void ThreadPool::_workerLoop(int index)
+{
+	long long seen = 0;
+	while (true)
+	{
+		function<void(int)> task;
+		{
+			unique_lock<mutex> lock(_mutex);
+			while ((!_stop) && (_generation == seen))
+				_startSignal.wait(lock);
+			if (_stop) return;
+			seen = _generation;
+			task = _task;
+		}
+		try
+		{
+			task(index);
+		}
+		catch (...)
+		{
+			unique_lock<mutex> lock(_mutex);
+			if (!_error) _error = current_exception();
+		}
+		{
+			unique_lock<mutex> lock(_mutex);
+			if (--_pending == 0) _doneSignal.notify_one();
+		}
+	}
+}
+
+//run():  calls task(i) once on every thread i and returns when they have all finished
+inline void ThreadPool::run(const function<void(int)>& task)
+{
+	{
+		unique_lock<mutex> lock(_mutex);
+		_task = task;
+		_error = exception_ptr();
+		_pending = (int)_workers.size();
+		_generation++;
+	}
+	_startSignal.notify_all();
+
+	exception_ptr callerError;
+	try
+	{
+		task(0);
+	}
+	catch (...)
+	{
+		callerError = current_exception();
+	}
+
+	exception_ptr workerError;
+	{
+		unique_lock<mutex> lock(_mutex);
+		while (_pending > 0)
+			_doneSignal.wait(lock);
+		workerError = _error;
+	}
+	if (callerError) rethrow_exception(callerError);
+	if (workerError) rethrow_exception(workerError);
+}
+
+//parallelFor():  splits [begin, end) into chunks of the given size that the threads claim in
+//turn from a shared counter, calling body(low, high, thread) for each chunk
+inline void ThreadPool::parallelFor(int begin, int end, int chunk, const function<void(int, int, int)>& body)
+{
+	if (begin >= end) return;
+	if (chunk < 1) chunk = 1;
+	if ((threadCount() == 1) || (end - begin <= chunk))
+	{
+		for (int low = begin; low < end; low += chunk)
+			body(low, min(end, low + chunk), 0);
+		return;
+	}
+	atomic<int> next(begin);
+	run([&](int index)
+	{
+		while (true)
+		{
+			int low = next.fetch_add(chunk);
+			if (low >= end) break;
+			body(low, min(end, low + chunk), index);
+		}
+	});
+}
+
+
+#endif	//_THREADPOOL_H
@@ -0,0 +1,238 @@
+/*	WeightMatrix.h
+*	WeightMatrix is the square weight matrix behind AdjacencyMatrixGraph, stored as one
+*	contiguous block instead of a vector per row.  Each row starts on a 64-byte boundary (the
+*	row length is padded to a whole number of cache lines), so a row walk is a straight pass
+*	through memory and can be done with aligned vector loads.  The element type is a template
+*	parameter:  float, uint16_t or uint8_t weights take 1/2 to 1/8 of the memory of double.
+*
+*	m[i] returns a pointer to row i, so m[i][j] reads and writes an entry as it did with
+*	vector<vector<double>>.  A zero entry means there is no edge.  The row scans are written as
+*	short fixed-length block loops that the compiler turns into vector compares.
+*	Author:  agent
+*	Date:  October 19, 2026
+*/
+
+#ifndef _WEIGHTMATRIX_H
+#define _WEIGHTMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include "Exception.h"
+
+using namespace std;
+
+class WeightMatrixException : public Exception { };
+class WeightMatrixMemory : public WeightMatrixException { };
+
+const int WEIGHT_MATRIX_ALIGN = 64;								//rows start on a cache line
+const int WEIGHT_MATRIX_SCAN_BYTES = 64;						//bytes tested at once by the row scans
+
+
+template <class WeightType>
+class WeightMatrix
+{
+protected:
+	char* _block;												//allocation holding the aligned data
+	WeightType* _data;											//first entry of row 0
+	int _size;													//rows and columns
+	size_t _stride;												//entries from one row to the next
+
+	char* _allocate(int n);										//switches to zeroed n x n storage, returns the old block
+
+public:
+	WeightMatrix();												//0 x 0 matrix
+	WeightMatrix(int n);										//n x n matrix of zeros
+	WeightMatrix(const WeightMatrix<WeightType>& m);
+	void operator= (const WeightMatrix<WeightType>& m);
+	virtual ~WeightMatrix();
+
+	void resize(int n);											//n x n, keeping the entries that still fit
+	int size() const;											//returns the number of rows
+	size_t stride() const;										//returns the padded row length
+	WeightType* operator[] (int row);							//returns row as an array
+	const WeightType* operator[] (int row) const;
+	int nextNonZero(int row, int from) const;					//first column >= from with a non-zero entry, -1 if none
+	int countNonZero(int row) const;							//number of non-zero entries in row
+};
+
+
+//default constructor
+template <class WeightType>
+WeightMatrix<WeightType>::WeightMatrix()
+{
+	static_assert(is_arithmetic<WeightType>::value, "WeightMatrix requires an arithmetic weight type");
+	_block = NULL;
+	_data = NULL;
+	_size = 0;
+	_stride = 0;
+}
+
+//constructor for an n x n matrix of zeros
+template <class WeightType>
+WeightMatrix<WeightType>::WeightMatrix(int n)
+{
+	static_assert(is_arithmetic<WeightType>::value, "WeightMatrix requires an arithmetic weight type");
+	_block = NULL;
+	_data = NULL;
+	_size = 0;
+	_stride = 0;
+	_allocate(n);
+}
+
+//copy constructor
+template <class WeightType>
+WeightMatrix<WeightType>::WeightMatrix(const WeightMatrix<WeightType>& m)
+{
+	_block = NULL;
+	_data = NULL;
+	_size = 0;
+	_stride = 0;
+	_allocate(m._size);
+	if (_size > 0) memcpy(_data, m._data, (size_t)_size * _stride * sizeof(WeightType));
+}
+
+//overloaded = operator:  copies the entries of another matrix.  If the copy cannot be
+//allocated the matrix is left as it was.
+template <class WeightType>
+void WeightMatrix<WeightType>::operator= (const WeightMatrix<WeightType>& m)
+{
+	if (&m == this) return;
+	delete[] _allocate(m._size);
+	if (_size > 0) memcpy(_data, m._data, (size_t)_size * _stride * sizeof(WeightType));
+}
+
+//destructor
+template <class WeightType>
+WeightMatrix<WeightType>::~WeightMatrix()
+{
+	delete[] _block;
+}
+
+//_allocate():  allocates zeroed storage for n x n entries with rows padded to whole cache
+//lines and only then makes it the matrix's storage, so a failed allocation throws
+//WeightMatrixMemory with the matrix unchanged.  Returns the previous block, which the caller
+//releases once it has copied what it needs.
+template <class WeightType>
+char* WeightMatrix<WeightType>::_allocate(int n)
+{
+	if (n < 0) throw WeightMatrixMemory();
+	size_t perLine = WEIGHT_MATRIX_ALIGN / sizeof(WeightType);
+	size_t stride = ((size_t)n + perLine - 1) / perLine * perLine;
+	if ((n > 0) && (stride > (SIZE_MAX - WEIGHT_MATRIX_ALIGN) / sizeof(WeightType) / n)) throw WeightMatrixMemory();
+	size_t bytes = (size_t)n * stride * sizeof(WeightType);
+	char* block = NULL;
+	WeightType* data = NULL;
+	if (bytes > 0)
+	{
+		try
+		{
+			block = new char[bytes + WEIGHT_MATRIX_ALIGN];
+		}
+		catch (bad_alloc&)
+		{
+			throw WeightMatrixMemory();
+		}
+		uintptr_t first = ((uintptr_t)block + WEIGHT_MATRIX_ALIGN - 1) & ~(uintptr_t)(WEIGHT_MATRIX_ALIGN - 1);
+		data = (WeightType*)first;
+		memset(data, 0, bytes);
+	}
+	char* oldBlock = _block;
+	_block = block;
+	_data = data;
+	_size = n;
+	_stride = stride;
+	return oldBlock;
+}
+
+//resize():  makes the matrix n x n.  Entries inside both the old and new sizes are kept and
+//new entries are zero.  If the new storage cannot be allocated the matrix is left as it was.
+template <class WeightType>
+void WeightMatrix<WeightType>::resize(int n)
+{
+	if (n == _size) return;
+	WeightType* oldData = _data;
+	int oldSize = _size;
+	size_t oldStride = _stride;
+	char* oldBlock = _allocate(n);
+	int keep = (oldSize < n) ? oldSize : n;
+	for (int i = 0; i < keep; i++)
+		memcpy(_data + i * _stride, oldData + i * oldStride, keep * sizeof(WeightType));
+	delete[] oldBlock;
+}
+
+//returns the number of rows (and columns)
+template <class WeightType>
+int WeightMatrix<WeightType>::size() const
+{
+	return _size;
+}
+
+//returns the distance in entries between the starts of consecutive rows
+template <class WeightType>
+size_t WeightMatrix<WeightType>::stride() const
+{
+	return _stride;
+}
+
+//returns a pointer to the first entry of row
+template <class WeightType>
+WeightType* WeightMatrix<WeightType>::operator[] (int row)
+{
+	return _data + (size_t)row * _stride;
+}
+
+template <class WeightType>
+const WeightType* WeightMatrix<WeightType>::operator[] (int row) const
+{
+	return _data + (size_t)row * _stride;
+}
+
+//nextNonZero():  returns the first column at or after from whose entry is non-zero, or -1.
+//A negative from starts at column 0.  Whole blocks of zeros are skipped with one vectorizable
+//test per block; the padding past the last column is always zero, so a block may run into it
+//safely.
+template <class WeightType>
+int WeightMatrix<WeightType>::nextNonZero(int row, int from) const
+{
+	const int block = WEIGHT_MATRIX_SCAN_BYTES / sizeof(WeightType);
+	const WeightType* r = (*this)[row];
+	int i = (from < 0) ? 0 : from;
+	while ((i < _size) && (i % block != 0))				//reach a block boundary
+	{
+		if (r[i] != 0) return i;
+		i++;
+	}
+	for (; i < _size; i += block)
+	{
+		bool any = false;
+		for (int k = 0; k < block; k++)
+			any |= (r[i + k] != 0);
+		if (!any) continue;
+		for (int k = 0; k < block; k++)
+			if (r[i + k] != 0) return i + k;
+	}
+	return -1;
+}
+
+//countNonZero():  number of non-zero entries in row, counted over whole blocks
+template <class WeightType>
+int WeightMatrix<WeightType>::countNonZero(int row) const
+{
+	const int block = WEIGHT_MATRIX_SCAN_BYTES / sizeof(WeightType);
+	const WeightType* r = (*this)[row];
+	int count = 0;
+	for (size_t i = 0; i < _stride; i += block)
+	{
+		int inBlock = 0;
+		for (int k = 0; k < block; k++)
+			inBlock += (r[i + k] != 0);
+		count += inBlock;
+	}
+	return count;
+}
+
+
+#endif	//_WEIGHTMATRIX_H